@@ -0,0 +1,4 @@
+COPY City FROM "City.csv" (escape ='\\', delim =',', quote='\"', header=false);
+COPY User FROM "User.csv" (escape ='\\', delim =',', quote='\"', header=false);
+COPY LivesIn FROM "LivesIn.csv" (escape ='\\', delim =',', quote='\"', header=false);
+COPY Follows FROM "Follows.csv" (escape ='\\', delim =',', quote='\"', header=false);
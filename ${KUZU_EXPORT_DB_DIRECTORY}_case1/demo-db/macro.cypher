@@ -0,0 +1 @@
+CREATE MACRO ADDWITHDEFAULT (a,b:=3) AS a + b
@@ -0,0 +1,4 @@
+COPY City FROM "City.csv" (escape ='\\', delim =',', quote='\"', header=true);
+COPY User FROM "User.csv" (escape ='\\', delim =',', quote='\"', header=true);
+COPY LivesIn FROM "LivesIn.csv" (escape ='\\', delim =',', quote='\"', header=true);
+COPY Follows FROM "Follows.csv" (escape ='\\', delim =',', quote='\"', header=true);
@@ -0,0 +1,4 @@
+COPY City FROM "City.parquet" (escape ='\\', delim =',', quote='\"', header=false);
+COPY User FROM "User.parquet" (escape ='\\', delim =',', quote='\"', header=false);
+COPY LivesIn FROM "LivesIn.parquet" (escape ='\\', delim =',', quote='\"', header=false);
+COPY Follows FROM "Follows.parquet" (escape ='\\', delim =',', quote='\"', header=false);
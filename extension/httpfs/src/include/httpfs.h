@@ -68,6 +68,8 @@ public:
 
     bool canHandleFile(const std::string& path) const override;
 
+    bool isRemote() const override { return true; }
+
     static std::unique_ptr<httplib::Client> getClient(const std::string& host);
 
     static std::unique_ptr<httplib::Headers> getHTTPHeaders(HeaderMap& headerMap);
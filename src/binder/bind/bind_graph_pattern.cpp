@@ -423,13 +423,26 @@ std::shared_ptr<RelExpression> Binder::createRecursiveQueryRel(const parser::Rel
         nodePredicate = expressionBinder.combineBooleanExpressions(ExpressionType::OR,
             nodePredicate, nodePredicateExecutionFlag);
     }
+    // Bind the rel weight of weighted shortest paths.
+    auto relType = relPattern.getRelType();
+    std::shared_ptr<Expression> weight;
+    auto weightPropertyName = clientContext->getClientConfig()->shortestPathWeightProperty;
+    if (relType == QueryRelType::SHORTEST && !weightPropertyName.empty()) {
+        weight = expressionBinder.bindNodeOrRelPropertyExpression(*rel, weightPropertyName);
+        if (!LogicalTypeUtils::isNumerical(weight->dataType)) {
+            throw BinderException(stringFormat(
+                "Cannot use property {} of type {} as the weight of shortest path {}.",
+                weightPropertyName, weight->dataType.toString(), relPattern.getVariableName()));
+        }
+        relType = QueryRelType::WEIGHTED_SHORTEST;
+    }
     // Bind rel
     restoreScope(std::move(prevScope));
     auto parsedName = relPattern.getVariableName();
     auto queryRel = make_shared<RelExpression>(
         *getRecursiveRelLogicalType(node->getDataType(), rel->getDataType()),
         getUniqueExpressionName(parsedName), parsedName, relTableIDs, std::move(srcNode),
-        std::move(dstNode), directionType, relPattern.getRelType());
+        std::move(dstNode), directionType, relType);
     auto lengthExpression = expressionBinder.createInternalLengthExpression(*queryRel);
     auto [lowerBound, upperBound] = bindVariableLengthRelBound(relPattern);
     auto recursiveInfo = std::make_unique<RecursiveInfo>();
@@ -442,6 +455,7 @@ std::shared_ptr<RelExpression> Binder::createRecursiveQueryRel(const parser::Rel
     recursiveInfo->nodePredicateExecFlag = std::move(nodePredicateExecutionFlag);
     recursiveInfo->nodePredicate = std::move(nodePredicate);
     recursiveInfo->relPredicate = std::move(relPredicate);
+    recursiveInfo->weight = std::move(weight);
     recursiveInfo->nodeProjectionList = std::move(nodeProjectionList);
     recursiveInfo->relProjectionList = std::move(relProjectionList);
     queryRel->setRecursiveInfo(std::move(recursiveInfo));
@@ -19,6 +19,10 @@ void FileInfo::readFromFile(void* buffer, uint64_t numBytes, uint64_t position)
     fileSystem->readFromFile(this, buffer, numBytes, position);
 }
 
+void FileInfo::readFromFileBatch(const std::vector<FileReadRequest>& requests) {
+    fileSystem->readFromFileBatch(this, requests);
+}
+
 int64_t FileInfo::readFile(void* buf, size_t nbyte) {
     return fileSystem->readFile(this, buf, nbyte);
 }
@@ -35,5 +39,9 @@ void FileInfo::truncate(uint64_t size) {
     fileSystem->truncate(this, size);
 }
 
+void FileInfo::syncFile() {
+    fileSystem->syncFile(this);
+}
+
 } // namespace common
 } // namespace kuzu
@@ -36,6 +36,13 @@ std::string FileSystem::getFileExtension(const std::filesystem::path& path) {
     return path.extension().string();
 }
 
+void FileSystem::readFromFileBatch(FileInfo* fileInfo,
+    const std::vector<FileReadRequest>& requests) const {
+    for (auto& request : requests) {
+        readFromFile(fileInfo, request.buffer, request.numBytes, request.position);
+    }
+}
+
 void FileSystem::writeFile(FileInfo* /*fileInfo*/, const uint8_t* /*buffer*/, uint64_t /*numBytes*/,
     uint64_t /*offset*/) const {
     KU_UNREACHABLE;
@@ -45,5 +52,9 @@ void FileSystem::truncate(FileInfo* /*fileInfo*/, uint64_t /*size*/) const {
     KU_UNREACHABLE;
 }
 
+void FileSystem::syncFile(FileInfo* /*fileInfo*/) const {
+    KU_UNREACHABLE;
+}
+
 } // namespace common
 } // namespace kuzu
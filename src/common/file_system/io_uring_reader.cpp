@@ -0,0 +1,154 @@
+#include "common/file_system/io_uring_reader.h"
+
+#include "common/assert.h"
+#include "common/exception/io.h"
+#include "common/string_format.h"
+#include "common/system_message.h"
+
+#if defined(KUZU_IO_URING)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace kuzu {
+namespace common {
+
+#if defined(KUZU_IO_URING)
+
+template<typename T>
+static T* getRingField(void* ring, uint32_t offset) {
+    return reinterpret_cast<T*>(reinterpret_cast<uint8_t*>(ring) + offset);
+}
+
+IOUringReader::IOUringReader() {
+    io_uring_params params{};
+    auto fd = (int)syscall(__NR_io_uring_setup, QUEUE_DEPTH, &params);
+    if (fd < 0) {
+        return;
+    }
+    sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    auto singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (singleMmap) {
+        sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);
+    }
+    sqRing = mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+        IORING_OFF_SQ_RING);
+    cqRing = singleMmap ? sqRing :
+                          mmap(nullptr, cqRingSize, PROT_READ | PROT_WRITE,
+                              MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+    sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    sqes = mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+        IORING_OFF_SQES);
+    if (sqRing == MAP_FAILED || cqRing == MAP_FAILED || sqes == MAP_FAILED) {
+        // LCOV_EXCL_START
+        if (sqRing != MAP_FAILED) {
+            munmap(sqRing, sqRingSize);
+        }
+        if (!singleMmap && cqRing != MAP_FAILED) {
+            munmap(cqRing, cqRingSize);
+        }
+        if (sqes != MAP_FAILED) {
+            munmap(sqes, sqesSize);
+        }
+        close(fd);
+        return;
+        // LCOV_EXCL_STOP
+    }
+    sqEntries = params.sq_entries;
+    sqHead = getRingField<uint32_t>(sqRing, params.sq_off.head);
+    sqTail = getRingField<uint32_t>(sqRing, params.sq_off.tail);
+    sqMask = getRingField<uint32_t>(sqRing, params.sq_off.ring_mask);
+    sqArray = getRingField<uint32_t>(sqRing, params.sq_off.array);
+    cqHead = getRingField<uint32_t>(cqRing, params.cq_off.head);
+    cqTail = getRingField<uint32_t>(cqRing, params.cq_off.tail);
+    cqMask = getRingField<uint32_t>(cqRing, params.cq_off.ring_mask);
+    cqes = getRingField<io_uring_cqe>(cqRing, params.cq_off.cqes);
+    ringFD = fd;
+}
+
+IOUringReader::~IOUringReader() {
+    if (!isAvailable()) {
+        return;
+    }
+    munmap(sqes, sqesSize);
+    if (cqRing != sqRing) {
+        munmap(cqRing, cqRingSize);
+    }
+    munmap(sqRing, sqRingSize);
+    close(ringFD);
+}
+
+void IOUringReader::read(int fd, const std::vector<FileReadRequest>& requests,
+    std::vector<int64_t>& numBytesRead) {
+    KU_ASSERT(isAvailable());
+    numBytesRead.assign(requests.size(), -EIO);
+    uint64_t numSubmitted = 0;
+    uint64_t numCompleted = 0;
+    while (numCompleted < requests.size()) {
+        // Fill the submission queue. We are its only producer.
+        auto tail = *sqTail;
+        while (numSubmitted < requests.size() &&
+               numSubmitted - numCompleted < std::min(sqEntries, QUEUE_DEPTH)) {
+            auto& request = requests[numSubmitted];
+            auto idx = tail & *sqMask;
+            auto sqe = reinterpret_cast<io_uring_sqe*>(sqes) + idx;
+            memset(sqe, 0, sizeof(io_uring_sqe));
+            sqe->opcode = IORING_OP_READ;
+            sqe->fd = fd;
+            sqe->addr = reinterpret_cast<uint64_t>(request.buffer);
+            sqe->len = request.numBytes;
+            sqe->off = request.position;
+            sqe->user_data = numSubmitted;
+            sqArray[idx] = idx;
+            tail++;
+            numSubmitted++;
+        }
+        __atomic_store_n(sqTail, tail, __ATOMIC_RELEASE);
+        // Submits whatever the kernel hasn't consumed yet and waits for at least one completion.
+        auto numToSubmit = tail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE);
+        if (syscall(__NR_io_uring_enter, ringFD, numToSubmit, 1 /* minComplete */,
+                IORING_ENTER_GETEVENTS, nullptr, 0) < 0 &&
+            errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            // LCOV_EXCL_START
+            throw IOException(stringFormat("io_uring_enter failed: {}", posixErrMessage()));
+            // LCOV_EXCL_STOP
+        }
+        auto head = *cqHead;
+        auto cqTailValue = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+        while (head != cqTailValue) {
+            auto cqe = reinterpret_cast<io_uring_cqe*>(cqes) + (head & *cqMask);
+            numBytesRead[cqe->user_data] = cqe->res;
+            head++;
+            numCompleted++;
+        }
+        __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+    }
+}
+
+#else
+
+IOUringReader::IOUringReader() = default;
+
+IOUringReader::~IOUringReader() = default;
+
+void IOUringReader::read(int /*fd*/, const std::vector<FileReadRequest>& /*requests*/,
+    std::vector<int64_t>& /*numBytesRead*/) {
+    KU_UNREACHABLE;
+}
+
+#endif
+
+IOUringReader& IOUringReader::getThreadLocal() {
+    thread_local IOUringReader reader;
+    return reader;
+}
+
+} // namespace common
+} // namespace kuzu
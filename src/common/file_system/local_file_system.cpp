@@ -1,6 +1,7 @@
 #include "common/file_system/local_file_system.h"
 
 #include "common/cast.h"
+#include "common/file_system/io_uring_reader.h"
 #include "common/string_utils.h"
 #include "main/client_context.h"
 #include "main/settings.h"
@@ -234,6 +235,30 @@ void LocalFileSystem::readFromFile(FileInfo* fileInfo, void* buffer, uint64_t nu
 #endif
 }
 
+void LocalFileSystem::readFromFileBatch(FileInfo* fileInfo,
+    const std::vector<FileReadRequest>& requests) const {
+#if !defined(_WIN32)
+    auto& reader = IOUringReader::getThreadLocal();
+    if (requests.size() > 1 && reader.isAvailable()) {
+        auto localFileInfo = ku_dynamic_cast<FileInfo*, LocalFileInfo*>(fileInfo);
+        std::vector<int64_t> numBytesRead;
+        reader.read(localFileInfo->fd, requests, numBytesRead);
+        for (auto i = 0u; i < requests.size(); i++) {
+            auto& request = requests[i];
+            if (numBytesRead[i] < 0 || (uint64_t)numBytesRead[i] != request.numBytes) {
+                // Failed and short reads are redone synchronously, which either completes them or
+                // reports the error as usual.
+                auto numBytesDone = numBytesRead[i] < 0 ? 0 : numBytesRead[i];
+                readFromFile(fileInfo, (uint8_t*)request.buffer + numBytesDone,
+                    request.numBytes - numBytesDone, request.position + numBytesDone);
+            }
+        }
+        return;
+    }
+#endif
+    FileSystem::readFromFileBatch(fileInfo, requests);
+}
+
 int64_t LocalFileSystem::readFile(FileInfo* fileInfo, void* buf, size_t nbyte) const {
     auto localFileInfo = ku_dynamic_cast<FileInfo*, LocalFileInfo*>(fileInfo);
 #if defined(_WIN32)
@@ -333,6 +358,24 @@ void LocalFileSystem::truncate(FileInfo* fileInfo, uint64_t size) const {
 #endif
 }
 
+void LocalFileSystem::syncFile(FileInfo* fileInfo) const {
+    auto localFileInfo = ku_dynamic_cast<FileInfo*, LocalFileInfo*>(fileInfo);
+#if defined(_WIN32)
+    if (!FlushFileBuffers((HANDLE)localFileInfo->handle)) {
+        auto error = GetLastError();
+        throw Exception(stringFormat("Failed to sync file {}. Error {}: {}", fileInfo->path, error,
+            systemErrMessage(error)));
+    }
+#else
+    if (fsync(localFileInfo->fd) < 0) {
+        // LCOV_EXCL_START
+        throw Exception(
+            stringFormat("Failed to sync file {}: {}", fileInfo->path, posixErrMessage()));
+        // LCOV_EXCL_STOP
+    }
+#endif
+}
+
 uint64_t LocalFileSystem::getFileSize(kuzu::common::FileInfo* fileInfo) const {
     auto localFileInfo = ku_dynamic_cast<FileInfo*, LocalFileInfo*>(fileInfo);
 #ifdef _WIN32
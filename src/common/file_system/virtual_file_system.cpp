@@ -68,6 +68,10 @@ void VirtualFileSystem::truncate(FileInfo* /*fileInfo*/, uint64_t /*size*/) cons
     KU_UNREACHABLE;
 }
 
+void VirtualFileSystem::syncFile(FileInfo* /*fileInfo*/) const {
+    KU_UNREACHABLE;
+}
+
 uint64_t VirtualFileSystem::getFileSize(kuzu::common::FileInfo* /*fileInfo*/) const {
     KU_UNREACHABLE;
 }
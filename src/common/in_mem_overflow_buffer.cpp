@@ -20,5 +20,17 @@ void InMemOverflowBuffer::allocateNewBlock() {
     blocks.push_back(std::move(newBlock));
 }
 
+void InMemOverflowBuffer::pinBlocks() {
+    for (auto& block : blocks) {
+        block->block->pin();
+    }
+}
+
+void InMemOverflowBuffer::unpinBlocks() {
+    for (auto& block : blocks) {
+        block->block->unpin();
+    }
+}
+
 } // namespace common
 } // namespace kuzu
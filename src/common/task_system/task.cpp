@@ -14,8 +14,21 @@ bool Task::registerThread() {
     return false;
 }
 
-void Task::deRegisterThreadAndFinalizeTask() {
+bool Task::tryYield() {
     lock_t lck{mtx};
+    if (getNumActiveThreadsNoLock() > 1) {
+        numThreadsYielding++;
+        return true;
+    }
+    return false;
+}
+
+void Task::deRegisterThreadAndFinalizeTask(bool yielded) {
+    lock_t lck{mtx};
+    if (yielded) {
+        numThreadsYielding--;
+        numThreadsYielded++;
+    }
     ++numThreadsFinished;
     if (!hasExceptionNoLock() && isCompletedNoLock()) {
         try {
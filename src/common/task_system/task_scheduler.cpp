@@ -1,13 +1,26 @@
 #include "common/task_system/task_scheduler.h"
 
+#include <algorithm>
+
 using namespace kuzu::common;
 
 namespace kuzu {
 namespace common {
 
-TaskScheduler::TaskScheduler(uint64_t numThreads) : stopThreads{false}, nextScheduledTaskID{0} {
+// The scheduler and the task of the worker thread, and whether the worker decided to yield the
+// task. Unset in threads other than the workers.
+static thread_local TaskScheduler* currentScheduler = nullptr;
+static thread_local ScheduledTask* currentTask = nullptr;
+static thread_local bool currentTaskYielded = false;
+
+TaskScheduler::TaskScheduler(uint64_t numThreads)
+    : nextScheduledTaskID{0}, stopThreads{false}, numTasksScheduled{0}, numUnstartedTasks{0},
+      numSleepingWorkers{0} {
+    for (auto n = 0u; n < std::max<uint64_t>(numThreads, 1); ++n) {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
     for (auto n = 0u; n < numThreads; ++n) {
-        threads.emplace_back([&] { runWorkerThread(); });
+        threads.emplace_back([&, n] { runWorkerThread(n); });
     }
 }
 
@@ -27,16 +40,12 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
         scheduleTaskAndWaitOrError(dependency, context);
     }
     auto scheduledTask = pushTaskIntoQueue(task);
-    cv.notify_all();
     std::unique_lock<std::mutex> taskLck{task->mtx, std::defer_lock};
     while (true) {
         taskLck.lock();
         bool timedWait = false;
         auto timeout = 0u;
         if (task->isCompletedNoLock()) {
-            // Note: we do not remove completed tasks from the queue in this function. They will be
-            // removed by the worker threads when they traverse down the queue for a task to work on
-            // (see getTaskAndRegister()).
             taskLck.unlock();
             break;
         }
@@ -58,75 +67,161 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
         }
         taskLck.unlock();
     }
+    // Workers may already have removed the task if it completed successfully, but erroring tasks
+    // are only removed here.
+    removeTask(*scheduledTask);
     if (task->hasException()) {
-        removeErroringTask(scheduledTask->ID);
         std::rethrow_exception(task->getExceptionPtr());
     }
 }
 
 std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueue(const std::shared_ptr<Task>& task) {
+    auto ID = nextScheduledTaskID.fetch_add(1);
+    auto scheduledTask = std::make_shared<ScheduledTask>(task, ID, ID % queues.size());
+    numUnstartedTasks++;
+    auto& queue = *queues[scheduledTask->queueIdx];
+    lock_t queueLck{queue.mtx};
+    queue.tasks.push_back(scheduledTask);
+    queueLck.unlock();
     lock_t lck{mtx};
-    auto scheduledTask = std::make_shared<ScheduledTask>(task, nextScheduledTaskID++);
-    taskQueue.push_back(scheduledTask);
+    numTasksScheduled++;
+    lck.unlock();
+    cv.notify_all();
     return scheduledTask;
 }
 
-std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister() {
-    if (taskQueue.empty()) {
-        return nullptr;
-    }
-    auto it = taskQueue.begin();
-    while (it != taskQueue.end()) {
-        auto task = (*it)->task;
-        if (!task->registerThread()) {
-            // If we cannot register for a thread it is because of three possibilities:
-            // (i) maximum number of threads have registered for task and the task is completed
-            // without an exception; or (ii) same as (i) but the task has not yet successfully
-            // completed; or (iii) task has an exception; Only in (i) we remove the task from the
-            // queue. For (ii) and (iii) we keep the task in queue. Recall erroring tasks need to be
-            // manually removed.
-            if (task->isCompletedSuccessfully()) { // option (i)
-                it = taskQueue.erase(it);
-            } else { // option (ii) or (iii): keep the task in the queue.
+std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister(uint64_t workerIdx) {
+    while (true) {
+        auto scheduledTask = getTaskToRegister(workerIdx);
+        if (scheduledTask == nullptr) {
+            return nullptr;
+        }
+        // Registration fails if the task stopped accepting threads since we picked it. Pick again.
+        if (scheduledTask->task->registerThread()) {
+            markStarted(*scheduledTask);
+            return scheduledTask;
+        }
+    }
+}
+
+std::shared_ptr<ScheduledTask> TaskScheduler::getTaskToRegister(uint64_t workerIdx) {
+    std::shared_ptr<ScheduledTask> bestTask = nullptr;
+    uint64_t bestNumThreads = 0, bestPriority = 1;
+    for (auto i = 0u; i < queues.size(); i++) {
+        auto& queue = *queues[(workerIdx + i) % queues.size()];
+        lock_t lck{queue.mtx};
+        auto it = queue.tasks.begin();
+        while (it != queue.tasks.end()) {
+            auto& task = *(*it)->task;
+            if (task.canRegister()) {
+                // Compare numThreads / priority of the tasks, keeping the earlier task on ties.
+                auto numThreads = task.getNumActiveThreads();
+                if (bestTask == nullptr ||
+                    numThreads * bestPriority < bestNumThreads * task.getPriority()) {
+                    bestTask = *it;
+                    bestNumThreads = numThreads;
+                    bestPriority = task.getPriority();
+                }
+                ++it;
+            } else if (task.isCompletedSuccessfully()) {
+                // If we cannot register for a thread it is because of three possibilities:
+                // (i) the task is completed without an exception; or (ii) the task is not yet
+                // completed but does not accept more threads; or (iii) task has an exception.
+                // Only in (i) we remove the task from the queue. Recall erroring tasks need to be
+                // manually removed.
+                it = queue.tasks.erase(it);
+            } else {
                 ++it;
             }
-        } else {
-            return *it;
         }
     }
-    return nullptr;
+    return bestTask;
 }
 
-void TaskScheduler::removeErroringTask(uint64_t scheduledTaskID) {
-    lock_t lck{mtx};
-    for (auto it = taskQueue.begin(); it != taskQueue.end(); ++it) {
-        if (scheduledTaskID == (*it)->ID) {
-            taskQueue.erase(it);
+void TaskScheduler::markStarted(ScheduledTask& scheduledTask) {
+    if (!scheduledTask.started.exchange(true)) {
+        numUnstartedTasks--;
+    }
+}
+
+bool TaskScheduler::shouldYieldCurrentTask() {
+    if (currentScheduler == nullptr || currentTask == nullptr) {
+        return false;
+    }
+    if (!currentTaskYielded) {
+        currentTaskYielded = currentScheduler->shouldYield(*currentTask);
+    }
+    return currentTaskYielded;
+}
+
+bool TaskScheduler::shouldYield(ScheduledTask& scheduledTask) {
+    // This is called once per morsel, so check first whether any task is waiting at all.
+    if (numUnstartedTasks.load() == 0 || numSleepingWorkers.load() > 0) {
+        return false;
+    }
+    auto& task = *scheduledTask.task;
+    auto numThreads = task.getNumActiveThreads();
+    if (numThreads <= 1) {
+        return false;
+    }
+    // Yield if the task keeps at least its share of threads after giving one to a waiting task,
+    // i.e. (numThreads - 1) / task priority >= 1 / waiting task priority.
+    auto hasWaitingTask = false;
+    for (auto& queue : queues) {
+        lock_t lck{queue->mtx};
+        for (auto& waitingTask : queue->tasks) {
+            if (!waitingTask->started && waitingTask->task->canRegister() &&
+                (numThreads - 1) * waitingTask->task->getPriority() >= task.getPriority()) {
+                hasWaitingTask = true;
+                break;
+            }
+        }
+        if (hasWaitingTask) {
+            break;
+        }
+    }
+    return hasWaitingTask && task.tryYield();
+}
+
+void TaskScheduler::removeTask(ScheduledTask& scheduledTask) {
+    markStarted(scheduledTask);
+    auto& queue = *queues[scheduledTask.queueIdx];
+    lock_t lck{queue.mtx};
+    for (auto it = queue.tasks.begin(); it != queue.tasks.end(); ++it) {
+        if (scheduledTask.ID == (*it)->ID) {
+            queue.tasks.erase(it);
             return;
         }
     }
 }
 
-void TaskScheduler::runWorkerThread() {
+void TaskScheduler::runWorkerThread(uint64_t workerIdx) {
+    currentScheduler = this;
     std::unique_lock<std::mutex> lck{mtx, std::defer_lock};
+    uint64_t numTasksSeen = 0;
     while (true) {
         lck.lock();
-        cv.wait(lck, [&] { return !taskQueue.empty() || stopThreads; });
+        // Sleep until a task is scheduled after the last time this worker found nothing to
+        // register to. Tasks which were already in the queues then don't accept more threads.
+        numSleepingWorkers++;
+        cv.wait(lck, [&] { return numTasksScheduled != numTasksSeen || stopThreads; });
+        numSleepingWorkers--;
         if (stopThreads) {
             return;
         }
-        auto scheduledTask = getTaskAndRegister();
+        numTasksSeen = numTasksScheduled;
         lck.unlock();
-        if (!scheduledTask) {
-            continue;
-        }
-        try {
-            scheduledTask->task->run();
-            scheduledTask->task->deRegisterThreadAndFinalizeTask();
-        } catch (std::exception& e) {
-            scheduledTask->task->setException(std::current_exception());
-            scheduledTask->task->deRegisterThreadAndFinalizeTask();
-            continue;
+        std::shared_ptr<ScheduledTask> scheduledTask;
+        while ((scheduledTask = getTaskAndRegister(workerIdx))) {
+            currentTask = scheduledTask.get();
+            currentTaskYielded = false;
+            try {
+                scheduledTask->task->run();
+            } catch (std::exception& e) {
+                scheduledTask->task->setException(std::current_exception());
+            }
+            currentTask = nullptr;
+            scheduledTask->task->deRegisterThreadAndFinalizeTask(currentTaskYielded);
         }
     }
 }
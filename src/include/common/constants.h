@@ -20,6 +20,11 @@ constexpr bool DEFAULT_ENABLE_SEMI_MASK = true;
 constexpr uint64_t THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS = 500;
 
 constexpr uint64_t DEFAULT_CHECKPOINT_WAIT_TIMEOUT_FOR_TRANSACTIONS_TO_LEAVE_IN_MICROS = 5000000;
+constexpr uint64_t DEFAULT_WAIT_TIMEOUT_FOR_WRITE_TRANSACTION_IN_MICROS = 5000000;
+// Write transactions are committed in memory and checkpointed into the database files in the
+// background once the WAL grows beyond the threshold, or at the latest after the interval.
+constexpr uint64_t DEFAULT_CHECKPOINT_THRESHOLD = 16 * 1024 * 1024;
+constexpr uint64_t CHECKPOINT_INTERVAL_IN_MICROS = 1000000;
 
 // Note that some places use std::bit_ceil to calculate resizes,
 // which won't work for values other than 2. If this is changed, those will need to be updated
@@ -96,6 +101,7 @@ struct StorageConstants {
     static constexpr char DATA_FILE_NAME[] = "data.kz";
     static constexpr char METADATA_FILE_NAME[] = "metadata.kz";
     static constexpr char LOCK_FILE_NAME[] = ".lock";
+    static constexpr char SPILL_FILE_NAME[] = "spill.tmp";
 
     // The number of pages that we add at one time when we need to grow a file.
     static constexpr uint64_t PAGE_GROUP_SIZE_LOG2 = 10;
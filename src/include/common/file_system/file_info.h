@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "common/api.h"
 
@@ -10,6 +11,13 @@ namespace common {
 
 class FileSystem;
 
+// A read of numBytes bytes at the given position of a file into buffer.
+struct FileReadRequest {
+    void* buffer;
+    uint64_t numBytes;
+    uint64_t position;
+};
+
 struct KUZU_API FileInfo {
     FileInfo(std::string path, FileSystem* fileSystem)
         : path{std::move(path)}, fileSystem{fileSystem} {}
@@ -20,6 +28,9 @@ struct KUZU_API FileInfo {
 
     void readFromFile(void* buffer, uint64_t numBytes, uint64_t position);
 
+    // Performs all the reads, possibly concurrently.
+    void readFromFileBatch(const std::vector<FileReadRequest>& requests);
+
     int64_t readFile(void* buf, size_t nbyte);
 
     void writeFile(const uint8_t* buffer, uint64_t numBytes, uint64_t offset);
@@ -28,6 +39,9 @@ struct KUZU_API FileInfo {
 
     void truncate(uint64_t size);
 
+    // Makes the written data of the file durable.
+    void syncFile();
+
     const std::string path;
 
     FileSystem* fileSystem;
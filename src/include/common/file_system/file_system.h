@@ -45,10 +45,18 @@ public:
 
     virtual bool canHandleFile(const std::string& /*path*/) const { KU_UNREACHABLE; }
 
+    // Reads from remote file systems are latency bound, so readers should fetch large ranges ahead
+    // of use.
+    virtual bool isRemote() const { return false; }
+
 protected:
     virtual void readFromFile(FileInfo* fileInfo, void* buffer, uint64_t numBytes,
         uint64_t position) const = 0;
 
+    // Reads the requests one at a time unless overridden.
+    virtual void readFromFileBatch(FileInfo* fileInfo,
+        const std::vector<FileReadRequest>& requests) const;
+
     virtual int64_t readFile(FileInfo* fileInfo, void* buf, size_t nbyte) const = 0;
 
     virtual void writeFile(FileInfo* fileInfo, const uint8_t* buffer, uint64_t numBytes,
@@ -58,6 +66,8 @@ protected:
 
     virtual void truncate(FileInfo* fileInfo, uint64_t size) const;
 
+    virtual void syncFile(FileInfo* fileInfo) const;
+
     virtual uint64_t getFileSize(FileInfo* fileInfo) const = 0;
 };
 
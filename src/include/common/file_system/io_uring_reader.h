@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "common/copy_constructors.h"
+#include "common/file_system/file_info.h"
+
+namespace kuzu {
+namespace common {
+
+// Reads batches of file ranges through io_uring, keeping up to QUEUE_DEPTH reads in flight instead
+// of issuing them one at a time. The ring is set up through raw system calls, so there is no
+// dependency on liburing. It is unavailable on other platforms, on kernels without io_uring, or
+// when io_uring is blocked (e.g. by seccomp), and callers then fall back to synchronous reads.
+class IOUringReader {
+public:
+    static constexpr uint32_t QUEUE_DEPTH = 64;
+
+    IOUringReader();
+    ~IOUringReader();
+    DELETE_COPY_AND_MOVE(IOUringReader);
+
+    bool isAvailable() const { return ringFD >= 0; }
+
+    // Sets numBytesRead[i] to the number of bytes read by requests[i], or to a negative errno if
+    // the read failed. Short reads are not retried.
+    void read(int fd, const std::vector<FileReadRequest>& requests,
+        std::vector<int64_t>& numBytesRead);
+
+    // Rings are not thread safe, so each thread uses its own.
+    static IOUringReader& getThreadLocal();
+
+private:
+    int ringFD = -1;
+    void* sqRing = nullptr;
+    uint64_t sqRingSize = 0;
+    void* cqRing = nullptr;
+    uint64_t cqRingSize = 0;
+    void* sqes = nullptr;
+    uint64_t sqesSize = 0;
+    uint32_t sqEntries = 0;
+
+    uint32_t* sqHead = nullptr;
+    uint32_t* sqTail = nullptr;
+    uint32_t* sqMask = nullptr;
+    uint32_t* sqArray = nullptr;
+    uint32_t* cqHead = nullptr;
+    uint32_t* cqTail = nullptr;
+    uint32_t* cqMask = nullptr;
+    void* cqes = nullptr;
+};
+
+} // namespace common
+} // namespace kuzu
@@ -50,6 +50,10 @@ protected:
     void readFromFile(FileInfo* fileInfo, void* buffer, uint64_t numBytes,
         uint64_t position) const override;
 
+    // Uses io_uring when available to keep all the reads in flight at once.
+    void readFromFileBatch(FileInfo* fileInfo,
+        const std::vector<FileReadRequest>& requests) const override;
+
     int64_t readFile(FileInfo* fileInfo, void* buf, size_t nbyte) const override;
 
     void writeFile(FileInfo* fileInfo, const uint8_t* buffer, uint64_t numBytes,
@@ -59,6 +63,8 @@ protected:
 
     void truncate(FileInfo* fileInfo, uint64_t size) const override;
 
+    void syncFile(FileInfo* fileInfo) const override;
+
     uint64_t getFileSize(FileInfo* fileInfo) const override;
 };
 
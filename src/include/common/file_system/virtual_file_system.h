@@ -45,6 +45,8 @@ protected:
 
     void truncate(FileInfo* fileInfo, uint64_t size) const override;
 
+    void syncFile(FileInfo* fileInfo) const override;
+
     uint64_t getFileSize(FileInfo* fileInfo) const override;
 
 private:
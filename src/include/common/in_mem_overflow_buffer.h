@@ -41,6 +41,9 @@ public:
         currentBlock = other.currentBlock;
     }
 
+    void pinBlocks();
+    void unpinBlocks();
+
     // Releases all memory accumulated for string overflows so far and re-initializes its state to
     // an empty buffer. If there is a large string that used point to any of these overflow buffers
     // they will error.
@@ -22,6 +22,10 @@ using lock_t = std::unique_lock<std::mutex>;
  * calls and if there is some state from the run() function execution that will be needed by
  * finalizeIfNecessary, users should save it somewhere that can be accessed in
  * finalizeIfNecessary(). See ProcessorTask for an example of this.
+ *
+ * A worker can also leave a task before the task runs out of work by yielding (see tryYield()), so
+ * that it can work on a task of a concurrent query instead. The work left is picked up by the
+ * threads that are still working on the task, or by workers that register to the task later on.
  */
 class Task {
     friend class TaskScheduler;
@@ -53,9 +57,29 @@ public:
 
     inline void setSingleThreadedTask() { maxNumThreads = 1; }
 
+    // The share of worker threads the task gets relative to other tasks, when there are more tasks
+    // than workers.
+    inline void setPriority(uint64_t priority_) { priority = priority_ == 0 ? 1 : priority_; }
+    inline uint64_t getPriority() const { return priority; }
+
     bool registerThread();
 
-    void deRegisterThreadAndFinalizeTask();
+    // Returns true if the calling thread can stop working on the task before it runs out of work,
+    // which is the case if at least one other thread keeps working on it. A thread that yields has
+    // to deregister itself with yielded set to true.
+    bool tryYield();
+
+    void deRegisterThreadAndFinalizeTask(bool yielded = false);
+
+    inline bool canRegister() {
+        lock_t lck{mtx};
+        return !hasExceptionNoLock() && canRegisterNoLock();
+    }
+
+    inline uint64_t getNumActiveThreads() {
+        lock_t lck{mtx};
+        return getNumActiveThreadsNoLock();
+    }
 
     inline void setException(std::exception_ptr exceptionPtr) {
         lock_t lck{mtx};
@@ -73,8 +97,15 @@ public:
     }
 
 private:
+    // Threads can register as long as no thread has finished because the task ran out of work.
     bool canRegisterNoLock() const {
-        return 0 == numThreadsFinished && maxNumThreads > numThreadsRegistered;
+        return numThreadsFinished == numThreadsYielded &&
+               maxNumThreads > numThreadsRegistered - numThreadsFinished;
+    }
+
+    // Threads that are working on the task and are not about to leave it.
+    inline uint64_t getNumActiveThreadsNoLock() const {
+        return numThreadsRegistered - numThreadsFinished - numThreadsYielding;
     }
 
     inline bool hasExceptionNoLock() const { return exceptionsPtr != nullptr; }
@@ -94,6 +125,9 @@ protected:
     std::mutex mtx;
     std::condition_variable cv;
     uint64_t maxNumThreads, numThreadsFinished{0}, numThreadsRegistered{0};
+    // Threads that decided to yield and have not deregistered yet, and threads that yielded.
+    uint64_t numThreadsYielding{0}, numThreadsYielded{0};
+    uint64_t priority{1};
     std::exception_ptr exceptionsPtr = nullptr;
     uint64_t ID;
 };
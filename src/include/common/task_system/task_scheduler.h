@@ -1,4 +1,5 @@
 #pragma once
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <thread>
@@ -10,31 +11,52 @@ namespace kuzu {
 namespace common {
 
 struct ScheduledTask {
-    ScheduledTask(std::shared_ptr<Task> task, uint64_t ID) : task{std::move(task)}, ID{ID} {};
+    ScheduledTask(std::shared_ptr<Task> task, uint64_t ID, uint64_t queueIdx)
+        : task{std::move(task)}, ID{ID}, queueIdx{queueIdx}, started{false} {};
     std::shared_ptr<Task> task;
     uint64_t ID;
+    // Index of the worker queue holding the task.
+    uint64_t queueIdx;
+    // Whether a worker has registered to the task.
+    std::atomic<bool> started;
+};
+
+// Tasks assigned to one worker thread. Other workers steal tasks from it when they have nothing
+// to work on in their own queue.
+struct WorkerQueue {
+    std::mutex mtx;
+    std::deque<std::shared_ptr<ScheduledTask>> tasks;
 };
 
 /**
  * TaskScheduler is a library that manages a set of worker threads that can execute tasks that are
- * put into a task queue. Each task accepts a maximum number of threads. Users of TaskScheduler
+ * put into task queues. Each task accepts a maximum number of threads. Users of TaskScheduler
  * schedule tasks to be executed by calling schedule functions, e.g., pushTaskIntoQueue or
- * scheduleTaskAndWaitOrError. New tasks are put at the end of the queue. Workers grab the first
- * task from the beginning of the queue that they can register themselves to work on. Any task that
- * is completed is removed automatically from the queue. If there is a task that raises an
- * exception, the worker threads catch it and store it with the tasks. The user thread that is
- * waiting on the completion of the task (or tasks) will throw the exception (the user thread could
- * be waiting on a tasks through a function that waits, e.g., scheduleTaskAndWaitOrError.
+ * scheduleTaskAndWaitOrError. Each worker thread has its own queue, and new tasks are put at the
+ * end of the queues in round-robin order, so that concurrent queries don't contend on a single
+ * lock. Workers grab the first task from the beginning of their own queue that they can register
+ * themselves to work on, and otherwise steal a task from the queues of the other workers. Workers
+ * with nothing to register to sleep until a new task is scheduled. Any task that is completed is
+ * removed from its queue. If there is a task that raises an exception, the worker threads catch it
+ * and store it with the tasks. The user thread that is waiting on the completion of the task (or
+ * tasks) will throw the exception (the user thread could be waiting on a tasks through a function
+ * that waits, e.g., scheduleTaskAndWaitOrError.
  *
  * Currently there is one way the TaskScheduler can be used:
  * Schedule one task T and wait for T to finish or error if there was an exception raised by
  * one of the threads working on T that errored. This is simply done by the call:
  *      scheduleTaskAndWaitOrError(T);
  *
- * TaskScheduler guarantees that workers will register themselves to tasks in FIFO order. However
- * this does not guarantee that the tasks will be completed in FIFO order: a long running task
- * that is not accepting more registration can stay in the queue for an unlimited time until
- * completion.
+ * Workers share themselves between the tasks they can register to in proportion to the priorities
+ * of the tasks (see Task::setPriority): a worker registers to the task with the fewest threads
+ * working on it per unit of priority, and among equally loaded tasks, to the first one of its own
+ * queue, or else of the other queues in FIFO order. So a long running query with many threads
+ * does not keep the workers from the queries scheduled after it. If all workers are busy while a
+ * task no worker has registered to yet waits, a worker of a task that has more than its share of
+ * threads yields it at the next point where the task can give up a thread (see
+ * shouldYieldCurrentTask). This does not guarantee that the tasks will be completed in FIFO order:
+ * a long running task that is not accepting more registration can stay in the queue for an
+ * unlimited time until completion.
  */
 class TaskScheduler {
 public:
@@ -49,22 +71,41 @@ public:
     void scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task,
         processor::ExecutionContext* context);
 
+    // Called by operators at points where the task the calling worker thread runs can give up the
+    // thread, i.e. other threads can finish the work left. Returns true if the thread should stop
+    // working on the task so that a task waiting for workers can start. Always false when called
+    // from outside of a worker thread.
+    static bool shouldYieldCurrentTask();
+
 private:
     std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task);
 
-    void removeErroringTask(uint64_t scheduledTaskID);
+    void removeTask(ScheduledTask& scheduledTask);
 
     // Functions to launch worker threads and for the worker threads to use to grab task from queue.
-    void runWorkerThread();
-    std::shared_ptr<ScheduledTask> getTaskAndRegister();
+    void runWorkerThread(uint64_t workerIdx);
+    // Looks for a task in the worker's own queue first, then in the other queues.
+    std::shared_ptr<ScheduledTask> getTaskAndRegister(uint64_t workerIdx);
+    // Returns the task with the fewest active threads per unit of priority that the worker can
+    // register to, removing the completed tasks it comes across.
+    std::shared_ptr<ScheduledTask> getTaskToRegister(uint64_t workerIdx);
+
+    bool shouldYield(ScheduledTask& scheduledTask);
+    void markStarted(ScheduledTask& scheduledTask);
 
 private:
-    std::deque<std::shared_ptr<ScheduledTask>> taskQueue;
-    bool stopThreads;
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
     std::vector<std::thread> threads;
+    std::atomic<uint64_t> nextScheduledTaskID;
+    // Protects stopThreads and numTasksScheduled, which workers wait on when they have no task to
+    // register to.
     std::mutex mtx;
     std::condition_variable cv;
-    uint64_t nextScheduledTaskID;
+    bool stopThreads;
+    uint64_t numTasksScheduled;
+    // Scheduled tasks that no worker has registered to yet, and workers waiting for a task.
+    std::atomic<uint64_t> numUnstartedTasks;
+    std::atomic<uint64_t> numSleepingWorkers;
 };
 
 } // namespace common
@@ -3,6 +3,7 @@
 #include "common/copier_config/reader_config.h"
 #include "common/types/types.h"
 #include "main/client_context.h"
+#include "storage/stats/column_chunk_stats.h"
 
 namespace kuzu {
 namespace common {
@@ -14,16 +15,28 @@ namespace function {
 struct TableFuncBindData {
     std::vector<common::LogicalType> columnTypes;
     std::vector<std::string> columnNames;
+    // Set by the planner. Skipped columns are not used by the query, so table functions may leave
+    // them unscanned.
+    std::vector<bool> columnSkips;
+    // Set by the planner. Comparisons between an output column (by index) and a constant which are
+    // still evaluated by a filter above the scan. Table functions may use them to skip input that
+    // cannot satisfy them.
+    std::vector<storage::ColumnPredicate> columnPredicates;
 
     TableFuncBindData() = default;
     TableFuncBindData(std::vector<common::LogicalType> columnTypes,
         std::vector<std::string> columnNames)
         : columnTypes{std::move(columnTypes)}, columnNames{std::move(columnNames)} {}
     TableFuncBindData(const TableFuncBindData& other)
-        : columnTypes{other.columnTypes}, columnNames{other.columnNames} {}
+        : columnTypes{other.columnTypes}, columnNames{other.columnNames},
+          columnSkips{other.columnSkips}, columnPredicates{other.columnPredicates} {}
 
     virtual ~TableFuncBindData() = default;
 
+    bool isColumnSkipped(common::column_id_t columnIdx) const {
+        return columnIdx < columnSkips.size() && columnSkips[columnIdx];
+    }
+
     virtual std::unique_ptr<TableFuncBindData> copy() const = 0;
 };
 
@@ -17,24 +17,34 @@ struct ClientConfig {
     uint64_t numThreads;
     // Timeout (milliseconds)
     uint64_t timeoutInMS;
+    // Share of worker threads that queries get relative to concurrent queries
+    uint64_t queryPriority;
     // variable length maximum depth
     uint32_t varLengthMaxDepth;
+    // Rel property whose sum shortest paths minimize. Empty means shortest paths minimize the
+    // number of rels.
+    std::string shortestPathWeightProperty;
     // If using progress bar
     bool enableProgressBar;
     // time before displaying progress bar
     uint64_t showProgressAfter;
     // If multi copy is enabled
     bool enableMultiCopy;
+    // If the results of read-only queries are streamed to the client instead of being
+    // materialized before the first tuple is returned.
+    bool streamResults;
 };
 
 struct ClientConfigDefault {
     // 0 means timeout is disabled by default.
     static constexpr uint64_t TIMEOUT_IN_MS = 0;
+    static constexpr uint64_t QUERY_PRIORITY = 1;
     static constexpr uint32_t VAR_LENGTH_MAX_DEPTH = 30;
     static constexpr bool ENABLE_SEMI_MASK = true;
     static constexpr bool ENABLE_PROGRESS_BAR = true;
     static constexpr uint64_t SHOW_PROGRESS_AFTER = 1000;
     static constexpr bool ENABLE_MULTI_COPY = false;
+    static constexpr bool STREAM_RESULTS = false;
 };
 
 } // namespace main
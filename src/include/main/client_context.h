@@ -49,11 +49,13 @@ struct ActiveQuery {
  */
 class ClientContext {
     friend class Connection;
+    friend class QueryResult;
     friend class binder::Binder;
     friend class binder::ExpressionBinder;
 
 public:
     explicit ClientContext(Database* database);
+    ~ClientContext();
 
     // Client config
     const ClientConfig* getClientConfig() const { return &config; }
@@ -145,6 +147,16 @@ private:
     std::unique_ptr<QueryResult> executeAndAutoCommitIfNecessaryNoLock(
         PreparedStatement* preparedStatement, uint32_t planIdx = 0u, bool requiredNexTx = true);
 
+    void initWriteTransactionNoLock(const PreparedStatement& preparedStatement);
+
+    bool canStreamResult(PreparedStatement* preparedStatement,
+        processor::PhysicalPlan* physicalPlan) const;
+    // The result of a streamed query keeps its transaction open until the result is exhausted.
+    // Before the next statement, the tuples the client has not read yet are materialized so that
+    // the transaction can end.
+    void closeResultStreamNoLock();
+    void finishResultStreamNoLock(bool success);
+
     void addScalarFunction(std::string name, function::function_set definitions);
 
     bool startUDFAutoTrx(transaction::TransactionContext* trx);
@@ -167,6 +179,8 @@ private:
     Database* database;
     // Progress bar for queries
     std::unique_ptr<common::ProgressBar> progressBar;
+    // Query result whose tuples are being streamed.
+    QueryResult* streamingResult;
     std::mutex mtx;
 };
 
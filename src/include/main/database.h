@@ -1,7 +1,10 @@
 #pragma once
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "common/api.h"
@@ -55,15 +58,22 @@ struct KUZU_API SystemConfig {
      * environment. This will be removed once we implemente a better solution later. The value is
      * default to 1 << 43 (8TB) under 64-bit environment and 1GB under 32-bit one (see
      * `DEFAULT_VM_REGION_MAX_SIZE`).
+     * @param checkpointThreshold The size of the WAL in bytes beyond which committed write
+     * transactions are checkpointed into the database files by a background thread. Until then,
+     * their changes are kept in the buffer pool and the WAL. The value is default to 16MB (see
+     * `DEFAULT_CHECKPOINT_THRESHOLD`). If 0, every write transaction is checkpointed when it
+     * commits.
      */
     explicit SystemConfig(uint64_t bufferPoolSize = -1u, uint64_t maxNumThreads = 0,
-        bool enableCompression = true, bool readOnly = false, uint64_t maxDBSize = -1u);
+        bool enableCompression = true, bool readOnly = false, uint64_t maxDBSize = -1u,
+        uint64_t checkpointThreshold = -1u);
 
     uint64_t bufferPoolSize;
     uint64_t maxNumThreads;
     bool enableCompression;
     bool readOnly;
     uint64_t maxDBSize;
+    uint64_t checkpointThreshold;
 };
 
 /**
@@ -127,13 +137,21 @@ private:
 
     // Commits and checkpoints a write transaction or rolls that transaction back. This involves
     // either replaying the WAL and either redoing or undoing and in either case at the end WAL is
-    // cleared.
+    // cleared. Write transactions that only update pages and table statistics are instead
+    // committed in memory: the WAL is redone into the buffer pool and kept until the next
+    // checkpoint.
     // skipCheckpointForTestingRecovery is used to simulate a failure before checkpointing in tests.
     void commit(transaction::Transaction* transaction, bool skipCheckpointForTestingRecovery);
     void rollback(transaction::Transaction* transaction, bool skipCheckpointForTestingRecovery);
+    void commitInMemory();
     void checkpointAndClearWAL(storage::WALReplayMode walReplayMode);
     void rollbackAndClearWAL();
     void recoverIfNecessary();
+    // Writes the changes of the write transactions committed in memory back to the database files
+    // and clears the WAL. Does nothing if a write transaction is active.
+    void checkpoint();
+    void runCheckpointThread();
+    void stopCheckpointThread();
 
 private:
     std::string databasePath;
@@ -151,6 +169,10 @@ private:
     std::unique_ptr<extension::ExtensionOptions> extensionOptions;
     std::unique_ptr<DatabaseManager> databaseManager;
     common::case_insensitive_map_t<std::unique_ptr<storage::StorageExtension>> storageExtensions;
+    std::thread checkpointThread;
+    std::mutex mtxForCheckpointThread;
+    std::condition_variable checkpointThreadCV;
+    bool checkpointThreadStopped;
 };
 
 } // namespace main
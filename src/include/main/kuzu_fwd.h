@@ -52,6 +52,7 @@ class FactorizedTable;
 class FlatTupleIterator;
 class PhysicalOperator;
 class PhysicalPlan;
+class ResultStream;
 } // namespace processor
 
 namespace transaction {
@@ -12,6 +12,8 @@
 namespace kuzu {
 namespace main {
 
+class ClientContext;
+
 struct DataTypeInfo {
 public:
     DataTypeInfo(common::LogicalTypeID typeID, std::string name)
@@ -85,7 +87,8 @@ public:
      */
     KUZU_API std::vector<common::LogicalType> getColumnDataTypes() const;
     /**
-     * @return num of tuples in query result.
+     * @return num of tuples in query result. For a streamed query result, the number of tuples
+     * pulled so far, which is the total once all tuples have been read.
      */
     KUZU_API uint64_t getNumTuples() const;
     /**
@@ -119,7 +122,7 @@ public:
     KUZU_API std::string toString();
 
     /**
-     * @brief Resets the result tuple iterator.
+     * @brief Resets the result tuple iterator. Not supported by streamed query results.
      */
     KUZU_API void resetIterator();
 
@@ -152,6 +155,15 @@ private:
         const std::vector<std::shared_ptr<binder::Expression>>& columns);
     void validateQuerySucceed() const;
 
+    // Streamed query results pull the next chunk of tuples once the previous one has been read.
+    // Errors while pulling fail the query result.
+    void initResultStream(std::unique_ptr<processor::ResultStream> resultStream_,
+        const std::vector<std::shared_ptr<binder::Expression>>& columns,
+        ClientContext* clientContext_);
+    void pullNextChunkIfNecessary();
+    // Pulls all remaining tuples so that the stream can end before the client reads them.
+    void materializeResultStream();
+
 private:
     // execution status
     bool success = true;
@@ -164,6 +176,8 @@ private:
     std::shared_ptr<processor::FactorizedTable> factorizedTable;
     std::unique_ptr<processor::FlatTupleIterator> iterator;
     std::shared_ptr<processor::FlatTuple> tuple;
+    std::unique_ptr<processor::ResultStream> resultStream;
+    ClientContext* clientContext = nullptr;
 
     // execution statistics
     std::unique_ptr<QuerySummary> querySummary;
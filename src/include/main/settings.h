@@ -1,5 +1,6 @@
 #pragma once
 
+#include "common/exception/runtime.h"
 #include "common/types/value/value.h"
 #include "main/client_context.h"
 
@@ -30,6 +31,22 @@ struct TimeoutSetting {
     }
 };
 
+struct QueryPrioritySetting {
+    static constexpr const char* name = "query_priority";
+    static constexpr const common::LogicalTypeID inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        KU_ASSERT(parameter.getDataType()->getLogicalTypeID() == common::LogicalTypeID::INT64);
+        auto priority = parameter.getValue<int64_t>();
+        if (priority < 1) {
+            throw common::RuntimeException("Query priority must be at least 1.");
+        }
+        context->getClientConfigUnsafe()->queryPriority = priority;
+    }
+    static common::Value getSetting(ClientContext* context) {
+        return common::Value(context->getClientConfig()->queryPriority);
+    }
+};
+
 struct ProgressBarSetting {
     static constexpr const char* name = "progress_bar";
     static constexpr const common::LogicalTypeID inputType = common::LogicalTypeID::BOOL;
@@ -68,6 +85,19 @@ struct VarLengthExtendMaxDepthSetting {
     }
 };
 
+struct ShortestPathWeightPropertySetting {
+    static constexpr const char* name = "shortest_path_weight_property";
+    static constexpr const common::LogicalTypeID inputType = common::LogicalTypeID::STRING;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        KU_ASSERT(parameter.getDataType()->getLogicalTypeID() == common::LogicalTypeID::STRING);
+        context->getClientConfigUnsafe()->shortestPathWeightProperty =
+            parameter.getValue<std::string>();
+    }
+    static common::Value getSetting(ClientContext* context) {
+        return common::Value::createValue(context->getClientConfig()->shortestPathWeightProperty);
+    }
+};
+
 struct EnableSemiMaskSetting {
     static constexpr const char* name = "enable_semi_mask";
     static constexpr const common::LogicalTypeID inputType = common::LogicalTypeID::BOOL;
@@ -116,5 +146,17 @@ struct EnableMultiCopySetting {
     }
 };
 
+struct StreamResultsSetting {
+    static constexpr const char* name = "stream_results";
+    static constexpr const common::LogicalTypeID inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        KU_ASSERT(parameter.getDataType()->getLogicalTypeID() == common::LogicalTypeID::BOOL);
+        context->getClientConfigUnsafe()->streamResults = parameter.getValue<bool>();
+    }
+    static common::Value getSetting(ClientContext* context) {
+        return common::Value(context->getClientConfig()->streamResults);
+    }
+};
+
 } // namespace main
 } // namespace kuzu
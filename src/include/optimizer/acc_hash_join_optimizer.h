@@ -19,6 +19,9 @@ private:
 
     bool tryProbeToBuildHJSIP(planner::LogicalOperator* op);
     bool tryBuildToProbeHJSIP(planner::LogicalOperator* op);
+    // Drops probe side tuples whose key is not in a bloom filter of the build side keys at the scan
+    // of the key.
+    bool tryBuildToProbeBloomFilterSIP(planner::LogicalOperator* op);
 
     void visitIntersect(planner::LogicalOperator* op) override;
 
@@ -31,6 +31,11 @@ private:
     std::shared_ptr<planner::LogicalOperator> visitScanNodePropertyReplace(
         const std::shared_ptr<planner::LogicalOperator>& op);
 
+    // Attach predicates to SCAN_FILE so that the table function can skip input that cannot satisfy
+    // them. The predicates are still applied as filters above the scan.
+    std::shared_ptr<planner::LogicalOperator> visitScanFileReplace(
+        const std::shared_ptr<planner::LogicalOperator>& op);
+
     // Rewrite SCAN_NODE_ID->SCAN_NODE_PROPERTY->FILTER as
     // SCAN_NODE_ID->(SCAN_NODE_PROPERTY->FILTER)*->SCAN_NODE_PROPERTY
     // so that filter with higher selectivity is applied before scanning.
@@ -39,6 +44,11 @@ private:
         std::shared_ptr<binder::Expression> predicate,
         std::shared_ptr<planner::LogicalOperator> child);
 
+    // Attach a pushed down predicate to the SCAN_NODE_PROPERTY of the node below op so that node
+    // groups that cannot satisfy it can be skipped using column chunk statistics.
+    static void attachPredicateToScanNode(const binder::Expression& nodeID,
+        std::shared_ptr<binder::Expression> predicate, planner::LogicalOperator* op);
+
     // Finish the current push down optimization by apply remaining predicates as a single filter.
     // And heuristically reorder equality predicates first in the filter.
     std::shared_ptr<planner::LogicalOperator> finishPushDown(
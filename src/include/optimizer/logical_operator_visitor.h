@@ -39,6 +39,12 @@ protected:
         return op;
     }
 
+    virtual void visitScanFile(planner::LogicalOperator* /*op*/) {}
+    virtual std::shared_ptr<planner::LogicalOperator> visitScanFileReplace(
+        std::shared_ptr<planner::LogicalOperator> op) {
+        return op;
+    }
+
     virtual void visitIndexScanNode(planner::LogicalOperator* /*op*/) {}
     virtual std::shared_ptr<planner::LogicalOperator> visitIndexScanNodeReplace(
         std::shared_ptr<planner::LogicalOperator> op) {
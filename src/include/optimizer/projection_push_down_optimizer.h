@@ -10,7 +10,7 @@ struct LogicalInsertInfo;
 namespace optimizer {
 
 // ProjectionPushDownOptimizer implements the logic to avoid materializing unnecessary properties
-// for hash join build.
+// for hash join build, and to avoid scanning file columns that are not in use.
 // Note the optimization is for properties & variables only but not for general expressions. This is
 // because it's hard to figure out what expression is in-use, e.g. COUNT(a.age) + 1, it could be
 // either the whole expression was evaluated in a WITH clause or only COUNT(a.age) was evaluated or
@@ -24,7 +24,10 @@ private:
 
     void visitPathPropertyProbe(planner::LogicalOperator* op) override;
     void visitExtend(planner::LogicalOperator* op) override;
+    void visitScanFile(planner::LogicalOperator* op) override;
     void visitAccumulate(planner::LogicalOperator* op) override;
+    void visitMarkAccumulate(planner::LogicalOperator* op) override;
+    void visitDistinct(planner::LogicalOperator* op) override;
     void visitFilter(planner::LogicalOperator* op) override;
     void visitHashJoin(planner::LogicalOperator* op) override;
     void visitIntersect(planner::LogicalOperator* op) override;
@@ -50,6 +53,8 @@ private:
 private:
     binder::expression_set propertiesInUse;
     binder::expression_set patternInUse;
+    // Variables are only tracked to skip file columns. They are never pruned from materialization.
+    binder::expression_set variablesInUse;
 };
 
 } // namespace optimizer
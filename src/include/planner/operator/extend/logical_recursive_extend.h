@@ -12,10 +12,12 @@ public:
     LogicalRecursiveExtend(std::shared_ptr<binder::NodeExpression> boundNode,
         std::shared_ptr<binder::NodeExpression> nbrNode, std::shared_ptr<binder::RelExpression> rel,
         ExtendDirection direction, RecursiveJoinType joinType,
-        std::shared_ptr<LogicalOperator> child, std::shared_ptr<LogicalOperator> recursiveChild)
+        std::shared_ptr<LogicalOperator> child, std::shared_ptr<LogicalOperator> recursiveChild,
+        std::shared_ptr<LogicalOperator> bwdRecursiveChild)
         : BaseLogicalExtend{LogicalOperatorType::RECURSIVE_EXTEND, std::move(boundNode),
               std::move(nbrNode), std::move(rel), direction, std::move(child)},
-          joinType{joinType}, recursiveChild{std::move(recursiveChild)} {}
+          joinType{joinType}, recursiveChild{std::move(recursiveChild)},
+          bwdRecursiveChild{std::move(bwdRecursiveChild)} {}
 
     f_group_pos_set getGroupsPosToFlatten() override;
 
@@ -25,15 +27,22 @@ public:
     inline void setJoinType(RecursiveJoinType joinType_) { joinType = joinType_; }
     inline RecursiveJoinType getJoinType() const { return joinType; }
     inline std::shared_ptr<LogicalOperator> getRecursiveChild() const { return recursiveChild; }
+    inline std::shared_ptr<LogicalOperator> getBwdRecursiveChild() const {
+        return bwdRecursiveChild;
+    }
 
     inline std::unique_ptr<LogicalOperator> copy() override {
         return std::make_unique<LogicalRecursiveExtend>(boundNode, nbrNode, rel, direction,
-            joinType, children[0]->copy(), recursiveChild->copy());
+            joinType, children[0]->copy(), recursiveChild->copy(),
+            bwdRecursiveChild == nullptr ? nullptr : bwdRecursiveChild->copy());
     }
 
 private:
     RecursiveJoinType joinType;
     std::shared_ptr<LogicalOperator> recursiveChild;
+    // Recursive plan extending in the opposite direction. Only planned for shortest paths, which
+    // can then be searched from both ends.
+    std::shared_ptr<LogicalOperator> bwdRecursiveChild;
 };
 
 class LogicalPathPropertyProbe : public LogicalOperator {
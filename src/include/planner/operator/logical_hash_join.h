@@ -40,7 +40,8 @@ public:
         : LogicalOperator{LogicalOperatorType::HASH_JOIN, std::move(probeSideChild),
               std::move(buildSideChild)},
           joinConditions(std::move(joinConditions)), joinType{joinType}, mark{std::move(mark)},
-          sip{SidewaysInfoPassing::NONE}, order{JoinSubPlanSolveOrder::ANY} {}
+          sip{SidewaysInfoPassing::NONE}, order{JoinSubPlanSolveOrder::ANY},
+          bloomFilterScan{nullptr} {}
 
     f_group_pos_set getGroupsPosToFlattenOnProbeSide();
     f_group_pos_set getGroupsPosToFlattenOnBuildSide();
@@ -69,6 +70,11 @@ public:
     inline void setJoinSubPlanSolveOrder(JoinSubPlanSolveOrder order_) { order = order_; }
     inline JoinSubPlanSolveOrder getJoinSubPlanSolveOrder() const { return order; }
 
+    // Probe side scan of the join key which drops nodes whose key is not in a bloom filter of the
+    // build side keys.
+    inline void setBloomFilterScan(LogicalOperator* scan) { bloomFilterScan = scan; }
+    inline LogicalOperator* getBloomFilterScan() const { return bloomFilterScan; }
+
     inline std::unique_ptr<LogicalOperator> copy() override {
         return make_unique<LogicalHashJoin>(joinConditions, joinType, mark, children[0]->copy(),
             children[1]->copy());
@@ -93,6 +99,7 @@ private:
     std::shared_ptr<binder::Expression> mark; // when joinType is Mark
     SidewaysInfoPassing sip;
     JoinSubPlanSolveOrder order; // sip introduce join dependency
+    LogicalOperator* bloomFilterScan;
 };
 
 } // namespace planner
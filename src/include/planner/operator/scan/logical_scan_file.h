@@ -18,11 +18,25 @@ public:
     bool hasOffset() const { return offset != nullptr; }
     std::shared_ptr<binder::Expression> getOffset() const { return offset; }
 
+    // Columns which are not used by any operator above this scan and need not be scanned.
+    void setColumnSkips(std::vector<bool> skips) { columnSkips = std::move(skips); }
+    const std::vector<bool>& getColumnSkips() const { return columnSkips; }
+
+    // Predicates on the scanned columns which are evaluated by a filter above this scan. They can
+    // be used by the table function to skip input that cannot match.
+    void addPredicate(std::shared_ptr<binder::Expression> predicate) {
+        predicates.push_back(std::move(predicate));
+    }
+    binder::expression_vector getPredicates() const { return predicates; }
+
     void computeFactorizedSchema() final;
     void computeFlatSchema() final;
 
     std::unique_ptr<LogicalOperator> copy() final {
-        return std::make_unique<LogicalScanFile>(info.copy(), offset);
+        auto op = std::make_unique<LogicalScanFile>(info.copy(), offset);
+        op->columnSkips = columnSkips;
+        op->predicates = predicates;
+        return op;
     }
 
 private:
@@ -30,6 +44,8 @@ private:
     // ScanFile may be used as a source operator for COPY pipeline. In such case, row offset needs
     // to be provided in order to generate internal ID.
     std::shared_ptr<binder::Expression> offset;
+    std::vector<bool> columnSkips;
+    binder::expression_vector predicates;
 };
 
 } // namespace planner
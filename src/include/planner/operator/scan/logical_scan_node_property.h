@@ -26,15 +26,25 @@ public:
     inline std::vector<common::table_id_t> getTableIDs() const { return nodeTableIDs; }
     inline binder::expression_vector getProperties() const { return properties; }
 
+    // Predicates on the node's properties which are evaluated by a filter above this scan. They
+    // can be checked against column chunk statistics to skip node groups that cannot match.
+    inline void addPredicate(std::shared_ptr<binder::Expression> predicate) {
+        predicates.push_back(std::move(predicate));
+    }
+    inline binder::expression_vector getPredicates() const { return predicates; }
+
     inline std::unique_ptr<LogicalOperator> copy() final {
-        return make_unique<LogicalScanNodeProperty>(nodeID, nodeTableIDs, properties,
+        auto op = make_unique<LogicalScanNodeProperty>(nodeID, nodeTableIDs, properties,
             children[0]->copy());
+        op->predicates = predicates;
+        return op;
     }
 
 private:
     std::shared_ptr<binder::Expression> nodeID;
     std::vector<common::table_id_t> nodeTableIDs;
     binder::expression_vector properties;
+    binder::expression_vector predicates;
 };
 
 } // namespace planner
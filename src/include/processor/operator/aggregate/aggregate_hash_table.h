@@ -88,6 +88,9 @@ public:
 
     void resize(uint64_t newSize);
 
+    void pinBuffers() override;
+    void unpinBuffers() override;
+
 protected:
     virtual uint64_t matchFTEntries(const std::vector<common::ValueVector*>& flatKeyVectors,
         const std::vector<common::ValueVector*>& unFlatKeyVectors, uint64_t numMayMatches,
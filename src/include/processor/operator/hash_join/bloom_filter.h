@@ -0,0 +1,51 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "common/types/types.h"
+#include "common/utils.h"
+
+namespace kuzu {
+namespace processor {
+
+// Blocked bloom filter on the hashes of join keys. Each key sets NUM_BITS_PER_KEY bits of a single
+// 64-bit block, so a lookup reads one word. Blocks are selected with the high half of the hash,
+// and bits within a block with the low bits.
+class BloomFilter {
+public:
+    // Must be called before any key is inserted.
+    void init(uint64_t numKeys) {
+        auto numBlocks =
+            common::nextPowerOfTwo(std::max(numKeys / NUM_KEYS_PER_BLOCK, (uint64_t)1));
+        blocks.assign(numBlocks, 0);
+        blockIdxMask = numBlocks - 1;
+    }
+
+    void insert(common::hash_t hash) { blocks[getBlockIdx(hash)] |= getBitsInBlock(hash); }
+
+    bool mayContain(common::hash_t hash) const {
+        auto bits = getBitsInBlock(hash);
+        return (blocks[getBlockIdx(hash)] & bits) == bits;
+    }
+
+private:
+    uint64_t getBlockIdx(common::hash_t hash) const { return (hash >> 32) & blockIdxMask; }
+    static uint64_t getBitsInBlock(common::hash_t hash) {
+        uint64_t bits = 0;
+        for (auto i = 0u; i < NUM_BITS_PER_KEY; i++) {
+            bits |= (uint64_t)1 << ((hash >> (i * 6)) & 63);
+        }
+        return bits;
+    }
+
+private:
+    // About 8 to 16 bits per key, for which 3 bits per key give the fewest false positives.
+    static constexpr uint64_t NUM_KEYS_PER_BLOCK = 8;
+    static constexpr uint64_t NUM_BITS_PER_KEY = 3;
+    std::vector<uint64_t> blocks;
+    uint64_t blockIdxMask = 0;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "bloom_filter.h"
 #include "join_hash_table.h"
 #include "processor/operator/physical_operator.h"
 #include "processor/operator/sink.h"
@@ -28,9 +29,17 @@ public:
 
     inline JoinHashTable* getHashTable() { return hashTable.get(); }
 
+    // The bloom filter is populated with the keys of the hash table once it is built, and is used
+    // by probe side scans to drop tuples that cannot match.
+    inline void setBloomFilter(std::shared_ptr<BloomFilter> filter) {
+        bloomFilter = std::move(filter);
+    }
+    inline BloomFilter* getBloomFilter() const { return bloomFilter.get(); }
+
 protected:
     std::mutex mtx;
     std::unique_ptr<JoinHashTable> hashTable;
+    std::shared_ptr<BloomFilter> bloomFilter;
 };
 
 class HashJoinBuildInfo {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "bloom_filter.h"
 #include "processor/result/base_hash_table.h"
 #include "storage/buffer_manager/memory_manager.h"
 
@@ -21,7 +22,11 @@ public:
         std::vector<common::ValueVector*> payloadVectors);
 
     void allocateHashSlots(uint64_t numTuples);
+    // Tuples are inserted in the order they are stored in. Radix-partitioning them by slot range
+    // first keeps each partition's slots in cache, but the extra pass copying the tuples costs more
+    // than the cache misses it saves, so the build is not partitioned.
     void buildHashSlots();
+    void insertHashes(BloomFilter& bloomFilter) const;
 
     void probe(const std::vector<common::ValueVector*>& keyVectors, common::ValueVector* hashVector,
         common::ValueVector* tmpHashVector, uint8_t** probedTuples);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <mutex>
 
 #include "storage/store/node_table.h"
@@ -12,24 +13,57 @@ struct MaskUtil {
     static inline common::offset_t getMorselIdx(common::offset_t offset) {
         return offset >> common::DEFAULT_VECTOR_CAPACITY_LOG_2;
     }
+    static inline common::offset_t getPosInMorsel(common::offset_t offset) {
+        return offset & (common::DEFAULT_VECTOR_CAPACITY - 1);
+    }
 };
 
+// Mask values are allocated per morsel of offsets once a value in the morsel is set, so that a
+// mask only takes memory for the morsels it selects from instead of one byte per node of the table.
 struct MaskData {
-    uint8_t* data;
-
-    explicit MaskData(uint64_t size) {
-        dataBuffer = std::make_unique<uint8_t[]>(size);
-        data = dataBuffer.get();
-        std::fill(data, data + size, 0);
+    explicit MaskData(uint64_t size) : numMorsels{MaskUtil::getMorselIdx(size - 1) + 1} {
+        morsels = std::make_unique<std::atomic<uint8_t*>[]>(numMorsels);
+    }
+    ~MaskData() {
+        for (auto i = 0u; i < numMorsels; i++) {
+            delete[] morsels[i].load(std::memory_order_relaxed);
+        }
     }
 
-    inline void setMask(uint64_t pos, uint8_t maskValue) const { data[pos] = maskValue; }
+    inline void setMask(uint64_t pos, uint8_t maskValue) {
+        getOrAllocateMorsel(MaskUtil::getMorselIdx(pos))[MaskUtil::getPosInMorsel(pos)] =
+            maskValue;
+    }
     inline bool isMasked(uint64_t pos, uint8_t trueMaskVal) const {
-        return data[pos] == trueMaskVal;
+        auto values = getMorselValues(MaskUtil::getMorselIdx(pos));
+        if (values == nullptr) {
+            return trueMaskVal == 0;
+        }
+        return values[MaskUtil::getPosInMorsel(pos)] == trueMaskVal;
+    }
+    // Returns nullptr if no value of the morsel is set.
+    inline const uint8_t* getMorselValues(uint64_t morselIdx) const {
+        return morsels[morselIdx].load(std::memory_order_acquire);
+    }
+
+private:
+    uint8_t* getOrAllocateMorsel(uint64_t morselIdx) {
+        auto values = morsels[morselIdx].load(std::memory_order_acquire);
+        if (values != nullptr) {
+            return values;
+        }
+        auto newValues = std::make_unique<uint8_t[]>(common::DEFAULT_VECTOR_CAPACITY);
+        if (morsels[morselIdx].compare_exchange_strong(values, newValues.get(),
+                std::memory_order_acq_rel)) {
+            return newValues.release();
+        }
+        // Another thread allocated the morsel first.
+        return values;
     }
 
 private:
-    std::unique_ptr<uint8_t[]> dataBuffer;
+    uint64_t numMorsels;
+    std::unique_ptr<std::atomic<uint8_t*>[]> morsels;
 };
 
 // MaskCollection represents multiple mask on the same domain with AND semantic.
@@ -46,6 +80,28 @@ public:
     }
 
     inline bool isMasked(common::offset_t offset) { return maskData->isMasked(offset, numMasks); }
+    // Calls func on each masked offset in [startOffset, endOffset). Morsels without any set mask
+    // value are skipped, so there must be at least one mask.
+    template<typename Func>
+    void forEachMaskedOffset(common::offset_t startOffset, common::offset_t endOffset,
+        Func func) const {
+        KU_ASSERT(numMasks > 0);
+        auto offset = startOffset;
+        while (offset < endOffset) {
+            auto morselIdx = MaskUtil::getMorselIdx(offset);
+            auto morselEndOffset =
+                std::min((morselIdx + 1) * common::DEFAULT_VECTOR_CAPACITY, endOffset);
+            auto values = maskData->getMorselValues(morselIdx);
+            if (values != nullptr) {
+                for (; offset < morselEndOffset; offset++) {
+                    if (values[MaskUtil::getPosInMorsel(offset)] == numMasks) {
+                        func(offset);
+                    }
+                }
+            }
+            offset = morselEndOffset;
+        }
+    }
     // Increment mask value for the given nodeOffset if its current mask value is equal to
     // the specified `currentMaskValue`.
     inline void incrementMaskValue(common::offset_t offset, uint8_t currentMaskValue) {
@@ -106,6 +162,11 @@ public:
     inline bool isNodeMasked(common::offset_t nodeOffset) {
         return offsetMask->isMasked(nodeOffset);
     }
+    template<typename Func>
+    void forEachMaskedNode(common::offset_t startOffset, common::offset_t endOffset,
+        Func func) const {
+        offsetMask->forEachMaskedOffset(startOffset, endOffset, func);
+    }
 
 private:
     std::unique_ptr<MaskCollection> offsetMask;
@@ -146,6 +207,11 @@ public:
     inline bool isNodeMasked(common::offset_t nodeOffset) {
         return offsetMask->isMasked(nodeOffset);
     }
+    template<typename Func>
+    void forEachMaskedNode(common::offset_t startOffset, common::offset_t endOffset,
+        Func func) const {
+        offsetMask->forEachMaskedOffset(startOffset, endOffset, func);
+    }
 
 private:
     std::unique_ptr<MaskCollection> offsetMask;
@@ -17,8 +17,9 @@ class BaseCSVReader {
     friend class ParsingDriver;
 
 public:
+    // Values of skipped columns are not converted and are set to null in the scan result.
     BaseCSVReader(const std::string& filePath, common::CSVOption option, uint64_t numColumns,
-        main::ClientContext* context);
+        std::vector<bool> columnSkips, main::ClientContext* context);
 
     virtual ~BaseCSVReader() = default;
 
@@ -68,6 +69,7 @@ protected:
     common::CSVOption option;
 
     uint64_t numColumns;
+    std::vector<bool> columnSkips;
     std::unique_ptr<common::FileInfo> fileInfo;
 
     common::block_idx_t currentBlockIdx;
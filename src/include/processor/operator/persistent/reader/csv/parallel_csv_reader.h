@@ -16,7 +16,7 @@ class ParallelCSVReader final : public BaseCSVReader {
 
 public:
     ParallelCSVReader(const std::string& filePath, common::CSVOption option, uint64_t numColumns,
-        main::ClientContext* context);
+        std::vector<bool> columnSkips, main::ClientContext* context);
 
     bool hasMoreToRead() const;
     uint64_t parseBlock(common::block_idx_t blockIdx, common::DataChunk& resultChunk) override;
@@ -37,13 +37,16 @@ struct ParallelCSVLocalState final : public function::TableFuncLocalState {
 
 struct ParallelCSVScanSharedState final : public function::ScanFileSharedState {
     explicit ParallelCSVScanSharedState(common::ReaderConfig readerConfig, uint64_t numRows,
-        uint64_t numColumns, main::ClientContext* context, common::CSVReaderConfig csvReaderConfig)
+        uint64_t numColumns, std::vector<bool> columnSkips, main::ClientContext* context,
+        common::CSVReaderConfig csvReaderConfig)
         : ScanFileSharedState{std::move(readerConfig), numRows, context}, numColumns{numColumns},
-          numBlocksReadByFiles{0}, csvReaderConfig{std::move(csvReaderConfig)} {}
+          columnSkips{std::move(columnSkips)}, numBlocksReadByFiles{0},
+          csvReaderConfig{std::move(csvReaderConfig)} {}
 
     void setFileComplete(uint64_t completedFileIdx);
 
     uint64_t numColumns;
+    std::vector<bool> columnSkips;
     uint64_t numBlocksReadByFiles = 0;
     common::CSVReaderConfig csvReaderConfig;
 };
@@ -12,7 +12,7 @@ namespace processor {
 class SerialCSVReader final : public BaseCSVReader {
 public:
     SerialCSVReader(const std::string& filePath, common::CSVOption option, uint64_t numColumns,
-        main::ClientContext* context);
+        std::vector<bool> columnSkips, main::ClientContext* context);
 
     //! Sniffs CSV dialect and determines skip rows, header row, column types and column names
     std::vector<std::pair<std::string, common::LogicalType>> sniffCSV();
@@ -25,13 +25,16 @@ protected:
 struct SerialCSVScanSharedState final : public function::ScanFileSharedState {
     std::unique_ptr<SerialCSVReader> reader;
     uint64_t numColumns;
+    std::vector<bool> columnSkips;
     uint64_t totalReadSizeByFile;
     common::CSVReaderConfig csvReaderConfig;
 
     SerialCSVScanSharedState(common::ReaderConfig readerConfig, uint64_t numRows,
-        uint64_t numColumns, common::CSVReaderConfig csvReaderConfig, main::ClientContext* context)
+        uint64_t numColumns, std::vector<bool> columnSkips, common::CSVReaderConfig csvReaderConfig,
+        main::ClientContext* context)
         : ScanFileSharedState{std::move(readerConfig), numRows, context}, numColumns{numColumns},
-          totalReadSizeByFile{0}, csvReaderConfig{std::move(csvReaderConfig)} {
+          columnSkips{std::move(columnSkips)}, totalReadSizeByFile{0},
+          csvReaderConfig{std::move(csvReaderConfig)} {
         initReader(context);
     }
 
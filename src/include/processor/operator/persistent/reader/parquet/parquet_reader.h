@@ -1,5 +1,7 @@
 #pragma once
 
+#include <future>
+
 #include "column_reader.h"
 #include "common/data_chunk/data_chunk.h"
 #include "common/types/types.h"
@@ -8,6 +10,7 @@
 #include "function/table/scan_functions.h"
 #include "parquet/parquet_types.h"
 #include "resizable_buffer.h"
+#include "storage/stats/column_chunk_stats.h"
 #include "thrift/protocol/TCompactProtocol.h"
 
 namespace kuzu {
@@ -19,6 +22,14 @@ struct ParquetReaderPrefetchConfig {
     static constexpr double WHOLE_GROUP_PREFETCH_MINIMUM_SCAN = 0.95;
 };
 
+// Column chunks of a row group that are read in the background.
+struct ParquetGroupPrefetch {
+    uint64_t groupIdx;
+    std::unique_ptr<ReadAheadBuffer> buffer;
+    // Destroyed first, which waits for the read to finish before the buffer is freed.
+    std::future<void> fetched;
+};
+
 struct ParquetReaderScanState {
     std::vector<uint64_t> groupIdxList;
     int64_t currentGroup = -1;
@@ -32,15 +43,25 @@ struct ParquetReaderScanState {
     ResizeableBuffer defineBuf;
     ResizeableBuffer repeatBuf;
 
-    // TODO(Ziyi): We currently only support reading from local file system, thus the prefetch
-    // mode is disabled by default. Add this back when we support remote file system.
+    // Prefetch mode is enabled for remote files, where reads are latency bound. Row groups are then
+    // fetched with few large reads, and the next row group is read in the background while the
+    // current one is decoded.
     bool prefetchMode = false;
     bool currentGroupPrefetched = false;
+
+    // Background reads use their own file handle because file handles are not safe for concurrent
+    // use.
+    std::unique_ptr<common::FileInfo> prefetchFileInfo;
+    // The row group claimed to be scanned next, and the prefetched data of the group being scanned.
+    std::unique_ptr<ParquetGroupPrefetch> nextGroupPrefetch;
+    std::unique_ptr<ParquetGroupPrefetch> currentGroupPrefetch;
 };
 
 class ParquetReader {
 public:
-    ParquetReader(const std::string& filePath, main::ClientContext* context);
+    // Skipped columns are not read and are set to null in the scan result.
+    ParquetReader(const std::string& filePath, std::vector<bool> columnSkips,
+        main::ClientContext* context);
     ~ParquetReader() = default;
 
     void initializeScan(ParquetReaderScanState& state, std::vector<uint64_t> groups_to_read,
@@ -55,6 +76,16 @@ public:
 
     inline kuzu_parquet::format::FileMetaData* getMetadata() const { return metadata.get(); }
 
+    // Starts reading the column chunks of a row group in the background. The data is used the next
+    // time the row group is scanned with the same state.
+    void prefetchGroupAsync(ParquetReaderScanState& state, uint64_t groupIdx,
+        common::VirtualFileSystem* vfs);
+
+    // Returns true if the min/max statistics of the row group show that none of its rows can
+    // satisfy all the predicates. Predicates on nested columns are ignored.
+    bool canSkipRowGroup(uint64_t groupIdx,
+        const std::vector<storage::ColumnPredicate>& predicates) const;
+
 private:
     inline std::unique_ptr<kuzu_apache::thrift::protocol::TProtocol> createThriftProtocol(
         common::FileInfo* fileInfo_, bool prefetch_mode) {
@@ -72,10 +103,14 @@ private:
     static std::unique_ptr<common::LogicalType> deriveLogicalType(
         const kuzu_parquet::format::SchemaElement& s_ele);
     void initMetadata();
+    void initColumnLeaves();
     std::unique_ptr<ColumnReader> createReader();
     std::unique_ptr<ColumnReader> createReaderRecursive(uint64_t depth, uint64_t maxDefine,
         uint64_t maxRepeat, uint64_t& nextSchemaIdx, uint64_t& nextFileIdx);
     void prepareRowGroupBuffer(ParquetReaderScanState& state, uint64_t colIdx);
+    bool isColumnSkipped(uint64_t colIdx) const {
+        return colIdx < columnSkips.size() && columnSkips[colIdx];
+    }
     // Group span is the distance between the min page offset and the max page offset plus the max
     // page compressed size
     uint64_t getGroupSpan(ParquetReaderScanState& state);
@@ -84,16 +119,31 @@ private:
 
 private:
     const std::string filePath;
+    std::vector<bool> columnSkips;
     std::vector<std::string> columnNames;
     std::vector<std::unique_ptr<common::LogicalType>> columnTypes;
     std::unique_ptr<kuzu_parquet::format::FileMetaData> metadata;
+    // Position of each top-level column in the schema and in the column chunks of a row group.
+    struct ColumnLeaves {
+        uint64_t schemaIdx;
+        uint64_t startFileIdx;
+        uint64_t numFileColumns;
+        // Whether the column is stored as a single non-repeated leaf, whose chunk statistics
+        // describe the column values.
+        bool isPrimitive;
+    };
+    std::vector<ColumnLeaves> columnLeaves;
     main::ClientContext* context;
 };
 
 struct ParquetScanSharedState final : public function::ScanFileSharedState {
     explicit ParquetScanSharedState(const common::ReaderConfig readerConfig, uint64_t numRows,
+        std::vector<bool> columnSkips, std::vector<storage::ColumnPredicate> predicates,
         main::ClientContext* context);
 
+    std::vector<bool> columnSkips;
+    // Row groups whose statistics rule out any of the predicates are not scanned.
+    std::vector<storage::ColumnPredicate> predicates;
     std::vector<std::unique_ptr<ParquetReader>> readers;
     uint64_t totalRowsGroups;
     uint64_t numBlocksReadByFiles;
@@ -69,7 +69,7 @@ struct ReadAheadBuffer {
                 auto new_start =
                     std::min<uint64_t>(existing_head->location, new_read_head.location);
                 auto new_length =
-                    std::min<uint64_t>(existing_head->GetEnd(), new_read_head.GetEnd()) - new_start;
+                    std::max<uint64_t>(existing_head->GetEnd(), new_read_head.GetEnd()) - new_start;
                 existing_head->location = new_start;
                 existing_head->size = new_length;
                 return;
@@ -172,6 +172,12 @@ public:
     // Prefetch all previously registered ranges
     void PrefetchRegistered() { ra_buffer.Prefetch(); }
 
+    // Take over the read heads of a buffer that has already been prefetched
+    void AddPrefetched(ReadAheadBuffer& buffer) {
+        buffer.merge_set.clear();
+        ra_buffer.read_heads.splice(ra_buffer.read_heads.end(), buffer.read_heads);
+    }
+
     void ClearPrefetch() {
         ra_buffer.read_heads.clear();
         ra_buffer.merge_set.clear();
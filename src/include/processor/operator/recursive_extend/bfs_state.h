@@ -1,7 +1,5 @@
 #pragma once
 
-#include <algorithm>
-
 #include "frontier.h"
 
 namespace kuzu {
@@ -12,7 +10,7 @@ namespace processor {
 // not visit all target dst nodes because they may simply not connect to src.
 class TargetDstNodes {
 public:
-    TargetDstNodes(uint64_t numNodes, frontier::node_id_set_t nodeIDs)
+    TargetDstNodes(uint64_t numNodes, frontier::NodeIDSet nodeIDs)
         : numNodes{numNodes}, nodeIDs{std::move(nodeIDs)} {}
 
     inline void setTableIDFilter(std::unordered_set<common::table_id_t> filter) {
@@ -33,7 +31,7 @@ public:
 
 private:
     uint64_t numNodes;
-    frontier::node_id_set_t nodeIDs;
+    frontier::NodeIDSet nodeIDs;
     std::unordered_set<common::table_id_t> tableIDFilter;
 };
 
@@ -51,6 +49,18 @@ public:
         }
         return currentFrontier->nodeIDs[nextNodeIdxToExtend++];
     }
+    inline uint64_t getNumNodeIDsToExtend() const {
+        return currentFrontier->nodeIDs.size() - nextNodeIdxToExtend;
+    }
+    // Takes all nodes left to extend from current level. They stay valid until the level is
+    // finalized.
+    inline std::pair<const common::nodeID_t*, uint64_t> takeNodeIDsToExtend() {
+        auto numNodeIDs = getNumNodeIDsToExtend();
+        auto nodeIDs = currentFrontier->nodeIDs.data() + nextNodeIdxToExtend;
+        nextNodeIdxToExtend = currentFrontier->nodeIDs.size();
+        return {nodeIDs, numNodeIDs};
+    }
+    inline uint8_t getCurrentLevel() const { return currentLevel; }
 
     virtual void resetState() {
         currentLevel = 0;
@@ -90,7 +100,7 @@ protected:
         nextNodeIdxToExtend = 0;
         if (currentLevel < upperBound) { // No need to sort if we are not extending further.
             addNextFrontier();
-            std::sort(currentFrontier->nodeIDs.begin(), currentFrontier->nodeIDs.end());
+            currentFrontier->sortNodeIDs();
         }
     }
 
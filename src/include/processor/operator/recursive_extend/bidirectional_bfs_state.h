@@ -0,0 +1,72 @@
+#pragma once
+
+#include "bfs_state.h"
+
+namespace kuzu {
+namespace processor {
+
+/*
+ * BidirectionalBFSState computes the shortest paths between a src node and a single dst node by
+ * running a BFS from each of them, and extending at every level the side with the smaller frontier.
+ * The search stops at the first level where a node reached by one side was visited by the other.
+ *
+ * Let a and b be the levels reached by the src and dst side when they meet. All shortest paths
+ * have length a + b and go through the meeting nodes at distance a from src. Once the search is
+ * complete, these paths are laid out as the frontiers 0 to a + b of a BFS from src, so that the
+ * frontier scanners output them the same way as for a unidirectional BFS.
+ */
+class BidirectionalBFSState : public BaseBFSState {
+    struct Side {
+        // The i'th frontier holds the nodes at distance i from the start node of the side.
+        std::vector<std::unique_ptr<Frontier>> frontiers;
+        frontier::NodeIDSet visited;
+
+        inline Frontier* getLastFrontier() const { return frontiers.back().get(); }
+        inline uint8_t getNumLevels() const { return frontiers.size() - 1; }
+        void reset(common::nodeID_t startNodeID);
+    };
+
+public:
+    BidirectionalBFSState(uint8_t upperBound, TargetDstNodes* targetDstNodes, bool trackPath,
+        bool allShortest)
+        : BaseBFSState{upperBound, targetDstNodes}, trackPath{trackPath}, allShortest{allShortest},
+          srcNodeID{common::INVALID_OFFSET, common::INVALID_TABLE_ID},
+          dstNodeID{common::INVALID_OFFSET, common::INVALID_TABLE_ID}, isExtendingFromSrc{true} {}
+
+    void resetState() final;
+    bool isComplete() final;
+
+    void markSrc(common::nodeID_t nodeID) final;
+    void markDst(common::nodeID_t nodeID);
+    void markVisited(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID,
+        common::relID_t relID, uint64_t multiplicity) final;
+
+    // Picks the side with the smaller frontier to extend. Returns true for the src side.
+    bool startNextLevel();
+    void finalizeNextLevel();
+    // Lays out the shortest paths found as the frontiers of a BFS from src.
+    void populatePathFrontiers();
+
+private:
+    inline Side& getExtendingSide() { return isExtendingFromSrc ? srcSide : dstSide; }
+    inline Side& getOtherSide() { return isExtendingFromSrc ? dstSide : srcSide; }
+
+    // Adds the edges of the paths from the side's start node to the given nodes, walking back from
+    // the last frontier of the side.
+    void populatePathFrontiersFromSide(const Side& side, bool isSrcSide,
+        std::vector<common::nodeID_t> nodeIDs);
+
+private:
+    bool trackPath;
+    bool allShortest;
+    common::nodeID_t srcNodeID;
+    common::nodeID_t dstNodeID;
+    Side srcSide;
+    Side dstSide;
+    bool isExtendingFromSrc;
+    // Nodes of the last frontier of the src side visited by the dst side.
+    std::vector<common::nodeID_t> meetingNodeIDs;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <bit>
+#include <type_traits>
 #include <unordered_map>
 
+#include "common/assert.h"
 #include "function/hash/hash_functions.h"
 
 namespace kuzu {
@@ -10,9 +13,181 @@ namespace processor {
 namespace frontier {
 using node_rel_id_t = std::pair<common::nodeID_t, common::relID_t>;
 
-using node_id_set_t = std::unordered_set<common::nodeID_t, function::InternalIDHasher>;
 template<typename T>
 using node_id_map_t = std::unordered_map<common::nodeID_t, T, function::InternalIDHasher>;
+
+/*
+ * NodeIDMap maps node IDs to values. A map starts as a hash map and switches to flat arrays indexed
+ * by node offset, one per node table, with a bitmap of the offsets present, once its nodes are
+ * dense enough in their offset range for the arrays to take at most twice the memory of the hash
+ * map. BFS that reach a large part of the graph then no longer hash or allocate per node. With an
+ * empty value type (see NodeIDSet), only the bitmap is kept.
+ */
+template<typename T>
+class NodeIDMap {
+    static constexpr bool IS_SET = std::is_empty_v<T>;
+    static constexpr uint64_t VALUE_SIZE = IS_SET ? 0 : sizeof(T);
+    // Estimated size of a hash map entry besides its key and value: the next pointer, the cached
+    // hash and the bucket pointer.
+    static constexpr uint64_t HASH_MAP_ENTRY_OVERHEAD = 24;
+    static constexpr uint64_t SPARSE_BITS_PER_NODE =
+        8 * (sizeof(common::nodeID_t) + VALUE_SIZE + HASH_MAP_ENTRY_OVERHEAD);
+    static constexpr uint64_t DENSE_BITS_PER_OFFSET = 1 + 8 * VALUE_SIZE;
+
+    struct DenseTable {
+        // Offsets up to the largest one inserted.
+        uint64_t numOffsets = 0;
+        std::vector<uint64_t> bitmap;
+        std::vector<T> values;
+
+        inline bool contains(common::offset_t offset) const {
+            return offset < numOffsets && (bitmap[offset >> 6] >> (offset & 63)) & 1;
+        }
+        inline void resize(uint64_t numOffsets_) {
+            numOffsets = numOffsets_;
+            bitmap.resize((numOffsets + 63) >> 6, 0);
+            if constexpr (!IS_SET) {
+                values.resize(numOffsets);
+            }
+        }
+    };
+
+public:
+    NodeIDMap() : numNodes{0}, totalNumOffsets{0}, dense{false} {}
+
+    inline uint64_t size() const { return numNodes; }
+    inline bool empty() const { return numNodes == 0; }
+    inline bool isDense() const { return dense; }
+
+    inline bool contains(common::nodeID_t nodeID) const {
+        if (!dense) {
+            return sparseMap.contains(nodeID);
+        }
+        return nodeID.tableID < denseTables.size() &&
+               denseTables[nodeID.tableID].contains(nodeID.offset);
+    }
+
+    inline T& at(common::nodeID_t nodeID) {
+        static_assert(!IS_SET);
+        if (!dense) {
+            return sparseMap.at(nodeID);
+        }
+        KU_ASSERT(contains(nodeID));
+        return denseTables[nodeID.tableID].values[nodeID.offset];
+    }
+    inline const T& at(common::nodeID_t nodeID) const {
+        return const_cast<NodeIDMap*>(this)->at(nodeID);
+    }
+
+    // Returns false, leaving the map unchanged, if the node is already in the map.
+    bool insert(common::nodeID_t nodeID, T value = T{}) {
+        if (dense) {
+            auto& table = getDenseTable(nodeID);
+            if (table.contains(nodeID.offset)) {
+                return false;
+            }
+            setDense(table, nodeID.offset, std::move(value));
+            numNodes++;
+            return true;
+        }
+        if (!sparseMap.emplace(nodeID, std::move(value)).second) {
+            return false;
+        }
+        numNodes++;
+        auto& table = getDenseTable(nodeID);
+        if (nodeID.offset >= table.numOffsets) {
+            totalNumOffsets += nodeID.offset + 1 - table.numOffsets;
+            table.numOffsets = nodeID.offset + 1;
+        }
+        if (totalNumOffsets * DENSE_BITS_PER_OFFSET <= 2 * numNodes * SPARSE_BITS_PER_NODE) {
+            convertToDense();
+        }
+        return true;
+    }
+
+    // Appends the nodes of a dense map ordered by node ID.
+    void appendNodeIDs(std::vector<common::nodeID_t>& nodeIDs) const {
+        KU_ASSERT(dense);
+        for (common::table_id_t tableID = 0; tableID < denseTables.size(); tableID++) {
+            auto& bitmap = denseTables[tableID].bitmap;
+            for (uint64_t wordIdx = 0; wordIdx < bitmap.size(); wordIdx++) {
+                auto word = bitmap[wordIdx];
+                while (word != 0) {
+                    auto offset = (wordIdx << 6) + std::countr_zero(word);
+                    nodeIDs.push_back(common::nodeID_t{offset, tableID});
+                    word &= word - 1;
+                }
+            }
+        }
+    }
+
+    // Keeps the memory of the dense arrays for reuse.
+    void clear() {
+        sparseMap.clear();
+        for (auto& table : denseTables) {
+            table.numOffsets = 0;
+            table.bitmap.clear();
+            table.values.clear();
+        }
+        numNodes = 0;
+        totalNumOffsets = 0;
+        dense = false;
+    }
+
+private:
+    inline DenseTable& getDenseTable(common::nodeID_t nodeID) {
+        if (nodeID.tableID >= denseTables.size()) {
+            denseTables.resize(nodeID.tableID + 1);
+        }
+        auto& table = denseTables[nodeID.tableID];
+        if (dense && nodeID.offset >= table.numOffsets) {
+            table.resize(nodeID.offset + 1);
+        }
+        return table;
+    }
+
+    inline void setDense(DenseTable& table, common::offset_t offset, T value) {
+        table.bitmap[offset >> 6] |= (uint64_t)1 << (offset & 63);
+        if constexpr (!IS_SET) {
+            table.values[offset] = std::move(value);
+        }
+    }
+
+    void convertToDense() {
+        for (auto& table : denseTables) {
+            table.resize(table.numOffsets);
+        }
+        for (auto& [nodeID, value] : sparseMap) {
+            setDense(denseTables[nodeID.tableID], nodeID.offset, std::move(value));
+        }
+        // Release the buckets of the hash map.
+        node_id_map_t<T>{}.swap(sparseMap);
+        dense = true;
+    }
+
+private:
+    node_id_map_t<T> sparseMap;
+    // Indexed by table ID. Only track the number of offsets of each table while sparse.
+    std::vector<DenseTable> denseTables;
+    uint64_t numNodes;
+    uint64_t totalNumOffsets;
+    bool dense;
+};
+
+struct NoValue {};
+using NodeIDSet = NodeIDMap<NoValue>;
+
+// Backward edge to a node of a frontier from a node of the previous frontier. The edges to the same
+// node form a linked list in insertion order.
+struct BwdEdge {
+    node_rel_id_t nbrAndRelID;
+    uint64_t nextIdx;
+};
+struct BwdEdgeList {
+    uint64_t headIdx;
+    uint64_t tailIdx;
+};
+static constexpr uint64_t INVALID_BWD_EDGE_IDX = UINT64_MAX;
 } // namespace frontier
 
 /*
@@ -24,11 +199,14 @@ using node_id_map_t = std::unordered_map<common::nodeID_t, T, function::Internal
  * Shortest path NOT track path  |  nodeIDs
  * Var length track path         |  nodeIDs & bwdEdges
  * Var length NOT track path     |  nodeIDs & nodeIDToMultiplicity
+ *
+ * BwdEdges of all nodes are stored in a single vector, and indexed by node ID through a NodeIDMap.
  */
 class Frontier {
 public:
     inline void resetState() {
         nodeIDs.clear();
+        bwdEdgeLists.clear();
         bwdEdges.clear();
         nodeIDToMultiplicity.clear();
     }
@@ -37,14 +215,26 @@ public:
 
     void addNodeWithMultiplicity(common::nodeID_t nodeID, uint64_t multiplicity);
 
+    inline bool contains(common::nodeID_t nodeID) const {
+        return bwdEdgeLists.contains(nodeID) || nodeIDToMultiplicity.contains(nodeID);
+    }
+
     inline uint64_t getMultiplicity(common::nodeID_t nodeID) const {
         return nodeIDToMultiplicity.empty() ? 1 : nodeIDToMultiplicity.at(nodeID);
     }
 
+    inline uint64_t getFirstBwdEdgeIdx(common::nodeID_t nodeID) const {
+        return bwdEdgeLists.at(nodeID).headIdx;
+    }
+    inline const frontier::BwdEdge& getBwdEdge(uint64_t idx) const { return bwdEdges[idx]; }
+
+    void sortNodeIDs();
+
 public:
     std::vector<common::nodeID_t> nodeIDs;
-    frontier::node_id_map_t<std::vector<frontier::node_rel_id_t>> bwdEdges;
-    frontier::node_id_map_t<uint64_t> nodeIDToMultiplicity;
+    frontier::NodeIDMap<frontier::BwdEdgeList> bwdEdgeLists;
+    std::vector<frontier::BwdEdge> bwdEdges;
+    frontier::NodeIDMap<uint64_t> nodeIDToMultiplicity;
 };
 
 } // namespace processor
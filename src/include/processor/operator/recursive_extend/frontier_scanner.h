@@ -55,7 +55,11 @@ protected:
  * operator.
  */
 class PathScanner : public BaseFrontierScanner {
-    using nbrs_t = std::vector<frontier::node_rel_id_t>*;
+    // Position in the bwd edges of a node. INVALID_BWD_EDGE_IDX before the first edge.
+    struct BwdEdgeCursor {
+        uint64_t firstEdgeIdx;
+        uint64_t edgeIdx;
+    };
 
 public:
     PathScanner(TargetDstNodes* targetDstNodes, size_t k,
@@ -84,8 +88,7 @@ private:
     // DFS states
     std::vector<common::nodeID_t> nodeIDs;
     std::vector<common::relID_t> relIDs;
-    std::stack<nbrs_t> nbrsStack;
-    std::stack<int64_t> cursorStack;
+    std::stack<BwdEdgeCursor> cursorStack;
     std::unordered_map<common::table_id_t, std::string> tableIDToName;
 };
 
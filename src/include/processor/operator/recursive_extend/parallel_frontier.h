@@ -0,0 +1,74 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+#include "common/types/internal_id_t.h"
+
+namespace kuzu {
+namespace processor {
+
+// Edge found when extending a node of a frontier.
+struct FrontierEdge {
+    common::nodeID_t boundNodeID;
+    common::nodeID_t nbrNodeID;
+    common::relID_t relID;
+};
+
+/*
+ * ParallelFrontierLevel is a level of a BFS whose frontier is extended by several threads. The
+ * nodes of the frontier are split into morsels that any thread of the recursive join can extend.
+ * The thread computing the BFS applies the edges found to its BFS state in morsel order, so the
+ * result of the BFS does not depend on which thread extended which morsel.
+ */
+class ParallelFrontierLevel {
+    struct Morsel {
+        bool finished = false;
+        std::vector<FrontierEdge> edges;
+        std::exception_ptr exception = nullptr;
+    };
+
+public:
+    static constexpr uint64_t MORSEL_SIZE = 128;
+
+    // The nodes must stay valid until all morsels handed out are finished.
+    ParallelFrontierLevel(const common::nodeID_t* nodeIDs, uint64_t numNodes,
+        bool executeNodePredicate);
+
+    inline bool hasMorselsLeft() const { return nextMorselIdx.load() < morsels.size(); }
+    // Returns false once all morsels have been handed out.
+    bool getMorsel(uint64_t& morselIdx);
+    inline const common::nodeID_t* getMorselNodeIDs(uint64_t morselIdx) const {
+        return nodeIDs + morselIdx * MORSEL_SIZE;
+    }
+    inline uint64_t getMorselSize(uint64_t morselIdx) const {
+        return std::min(MORSEL_SIZE, numNodes - morselIdx * MORSEL_SIZE);
+    }
+    inline bool shouldExecuteNodePredicate() const { return executeNodePredicate; }
+
+    void finishMorsel(uint64_t morselIdx, std::vector<FrontierEdge> edges,
+        std::exception_ptr exception);
+    bool isMorselFinished(uint64_t morselIdx);
+    // Waits for the morsel to be finished and takes its edges, rethrowing the exception raised
+    // while extending it.
+    std::vector<FrontierEdge> takeMorselEdges(uint64_t morselIdx);
+
+    // Stops handing out morsels, and returns the number of morsels handed out.
+    uint64_t close();
+
+private:
+    const common::nodeID_t* nodeIDs;
+    uint64_t numNodes;
+    bool executeNodePredicate;
+    std::atomic<uint64_t> nextMorselIdx;
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::vector<Morsel> morsels;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -1,11 +1,14 @@
 #pragma once
 
 #include "bfs_state.h"
+#include "bidirectional_bfs_state.h"
 #include "common/enums/query_rel_type.h"
 #include "frontier_scanner.h"
+#include "parallel_frontier.h"
 #include "planner/operator/extend/recursive_join_type.h"
 #include "processor/operator/mask.h"
 #include "processor/operator/physical_operator.h"
+#include "weighted_shortest_path_state.h"
 
 namespace kuzu {
 namespace processor {
@@ -16,7 +19,26 @@ struct RecursiveJoinSharedState {
     std::vector<std::unique_ptr<NodeOffsetSemiMask>> semiMasks;
 
     explicit RecursiveJoinSharedState(std::vector<std::unique_ptr<NodeOffsetSemiMask>> semiMasks)
-        : semiMasks{std::move(semiMasks)} {}
+        : semiMasks{std::move(semiMasks)}, numThreadsWithSources{0}, numIdleThreads{0} {}
+
+    // Threads that may still compute BFS from sources of their own. Threads without sources left
+    // help them extend large frontiers (see ParallelFrontierLevel).
+    void registerThreadWithSources();
+    void deregisterThreadWithSources();
+    inline bool hasIdleThreads() const { return numIdleThreads.load() > 0; }
+
+    void addLevel(std::shared_ptr<ParallelFrontierLevel> level);
+    void removeLevel(ParallelFrontierLevel* level);
+    // Waits for a level with morsels left to extend. Returns nullptr once no thread has sources
+    // left.
+    std::shared_ptr<ParallelFrontierLevel> getLevelToHelp();
+
+private:
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::vector<std::shared_ptr<ParallelFrontierLevel>> levels;
+    uint64_t numThreadsWithSources;
+    std::atomic<uint64_t> numIdleThreads;
 };
 
 struct RecursiveJoinDataInfo {
@@ -31,6 +53,13 @@ struct RecursiveJoinDataInfo {
     DataPos recursiveDstNodeIDPos;
     std::unordered_set<common::table_id_t> recursiveDstNodeTableIDs;
     DataPos recursiveEdgeIDPos;
+    // Recursive plan extending in the opposite direction, to search shortest paths from the dst
+    // node. Not set if bidirectional search is not possible.
+    std::unique_ptr<ResultSetDescriptor> bwdLocalResultSetDescriptor;
+    DataPos bwdRecursiveDstNodeIDPos;
+    DataPos bwdRecursiveEdgeIDPos;
+    // Rel weight scanned by the recursive plan for weighted shortest paths.
+    DataPos recursiveWeightPos;
     // Path info
     DataPos pathPos;
     std::unordered_map<common::table_id_t, std::string> tableIDToName;
@@ -51,9 +80,16 @@ struct RecursiveJoinDataInfo {
           tableIDToName{std::move(tableIDToName)} {}
 
     inline std::unique_ptr<RecursiveJoinDataInfo> copy() {
-        return std::make_unique<RecursiveJoinDataInfo>(srcNodePos, dstNodePos, dstNodeTableIDs,
-            pathLengthPos, localResultSetDescriptor->copy(), recursiveDstNodeIDPos,
+        auto result = std::make_unique<RecursiveJoinDataInfo>(srcNodePos, dstNodePos,
+            dstNodeTableIDs, pathLengthPos, localResultSetDescriptor->copy(), recursiveDstNodeIDPos,
             recursiveDstNodeTableIDs, recursiveEdgeIDPos, pathPos, tableIDToName);
+        if (bwdLocalResultSetDescriptor != nullptr) {
+            result->bwdLocalResultSetDescriptor = bwdLocalResultSetDescriptor->copy();
+            result->bwdRecursiveDstNodeIDPos = bwdRecursiveDstNodeIDPos;
+            result->bwdRecursiveEdgeIDPos = bwdRecursiveEdgeIDPos;
+        }
+        result->recursiveWeightPos = recursiveWeightPos;
+        return result;
     }
 };
 
@@ -73,6 +109,9 @@ struct RecursiveJoinVectors {
 
     common::ValueVector* recursiveEdgeIDVector = nullptr;
     common::ValueVector* recursiveDstNodeIDVector = nullptr;
+    common::ValueVector* recursiveWeightVector = nullptr;
+    common::ValueVector* bwdRecursiveEdgeIDVector = nullptr;
+    common::ValueVector* bwdRecursiveDstNodeIDVector = nullptr;
 };
 
 class RecursiveJoin : public PhysicalOperator {
@@ -81,12 +120,15 @@ public:
         planner::RecursiveJoinType joinType, std::shared_ptr<RecursiveJoinSharedState> sharedState,
         std::unique_ptr<RecursiveJoinDataInfo> dataInfo, std::unique_ptr<PhysicalOperator> child,
         uint32_t id, const std::string& paramsString,
-        std::unique_ptr<PhysicalOperator> recursiveRoot)
+        std::unique_ptr<PhysicalOperator> recursiveRoot,
+        std::unique_ptr<PhysicalOperator> bwdRecursiveRoot)
         : PhysicalOperator{PhysicalOperatorType::RECURSIVE_JOIN, std::move(child), id,
               paramsString},
           lowerBound{lowerBound}, upperBound{upperBound}, queryRelType{queryRelType},
           joinType{joinType}, sharedState{std::move(sharedState)}, dataInfo{std::move(dataInfo)},
-          recursiveRoot{std::move(recursiveRoot)} {}
+          recursiveRoot{std::move(recursiveRoot)}, bwdRecursiveRoot{std::move(bwdRecursiveRoot)},
+          hasSources{false}, sourcesExhausted{false} {}
+    ~RecursiveJoin() override;
 
     inline RecursiveJoinSharedState* getSharedState() const { return sharedState.get(); }
 
@@ -95,13 +137,16 @@ public:
     bool getNextTuplesInternal(ExecutionContext* context) final;
 
     inline std::unique_ptr<PhysicalOperator> clone() final {
+        auto bwdRecursiveRootCopy =
+            bwdRecursiveRoot == nullptr ? nullptr : bwdRecursiveRoot->clone();
         return std::make_unique<RecursiveJoin>(lowerBound, upperBound, queryRelType, joinType,
             sharedState, dataInfo->copy(), children[0]->clone(), id, paramsString,
-            recursiveRoot->clone());
+            recursiveRoot->clone(), std::move(bwdRecursiveRootCopy));
     }
 
 private:
     void initLocalRecursivePlan(ExecutionContext* context);
+    void initLocalBwdRecursivePlan(ExecutionContext* context);
 
     void populateTargetDstNodes(ExecutionContext* context);
 
@@ -112,6 +157,21 @@ private:
 
     void updateVisitedNodes(common::nodeID_t boundNodeID);
 
+    // Compute shortest paths from a given src node to the single target dst node, extending from
+    // both nodes.
+    void computeBidirectionalBFS(ExecutionContext* context);
+
+    // Compute the cheapest paths from a given src node.
+    void computeWeightedShortestPaths(ExecutionContext* context);
+
+    // Extends the nodes left in the current frontier together with idle threads.
+    void extendCurrentFrontierInParallel(ExecutionContext* context);
+    // Returns true if the BFS completed before all edges were applied.
+    bool applyFrontierEdges(const std::vector<FrontierEdge>& edges);
+    void extendMorsel(ParallelFrontierLevel& level, uint64_t morselIdx, ExecutionContext* context);
+    // Extends morsels of the BFS of other threads until no thread has sources left.
+    void helpOtherThreads(ExecutionContext* context);
+
 private:
     uint8_t lowerBound;
     uint8_t upperBound;
@@ -125,11 +185,23 @@ private:
     std::unique_ptr<ResultSet> localResultSet;
     std::unique_ptr<PhysicalOperator> recursiveRoot;
     ScanFrontier* scanFrontier;
+    std::unique_ptr<ResultSet> bwdLocalResultSet;
+    std::unique_ptr<PhysicalOperator> bwdRecursiveRoot;
+    ScanFrontier* bwdScanFrontier;
 
     std::unique_ptr<RecursiveJoinVectors> vectors;
     std::unique_ptr<BaseBFSState> bfsState;
     std::unique_ptr<FrontiersScanner> frontiersScanner;
     std::unique_ptr<TargetDstNodes> targetDstNodes;
+    // Used instead of bfsState if the shortest paths can be searched from both ends.
+    std::unique_ptr<BidirectionalBFSState> bidirectionalState;
+    common::nodeID_t singleTargetDstNodeID;
+    // Used instead of bfsState for weighted shortest paths.
+    std::unique_ptr<WeightedShortestPathState> weightedState;
+    // Whether this thread is registered in the shared state as having sources, and whether it
+    // consumed all of them.
+    bool hasSources;
+    bool sourcesExhausted;
 };
 
 } // namespace processor
@@ -31,10 +31,9 @@ public:
 
     inline void markVisited(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID,
         common::nodeID_t relID, uint64_t /*multiplicity*/) final {
-        if (visited.contains(nbrNodeID)) {
+        if (!visited.insert(nbrNodeID)) {
             return;
         }
-        visited.insert(nbrNodeID);
         if (targetDstNodes->contains(nbrNodeID)) {
             numVisitedDstNodes++;
         }
@@ -52,7 +51,7 @@ private:
 
 private:
     uint64_t numVisitedDstNodes;
-    frontier::node_id_set_t visited;
+    frontier::NodeIDSet visited;
 };
 
 } // namespace processor
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <queue>
+
+#include "bfs_state.h"
+
+namespace kuzu {
+namespace processor {
+
+/*
+ * WeightedShortestPathState computes the paths with the smallest sum of rel weights from a src
+ * node with Dijkstra's algorithm, so weights cannot be negative. Nodes are settled in increasing
+ * order of their distance from src, and the search stops once all target dst nodes are settled.
+ *
+ * Once complete, the cheapest paths are laid out as the frontiers of a BFS from src, each node in
+ * the frontier of the number of rels on its path, so that the frontier scanners output them the
+ * same way as for a BFS. Nodes whose cheapest path has more rels than the upper bound are not
+ * output.
+ */
+class WeightedShortestPathState : public BaseBFSState {
+    struct NodeState {
+        double distance;
+        common::nodeID_t parentNodeID;
+        common::relID_t relID;
+        uint64_t numRels;
+        bool settled;
+    };
+    using queue_entry_t = std::pair<double, common::nodeID_t>;
+
+public:
+    WeightedShortestPathState(uint8_t upperBound, TargetDstNodes* targetDstNodes, bool trackPath)
+        : BaseBFSState{upperBound, targetDstNodes}, trackPath{trackPath}, numSettledDstNodes{0},
+          boundDistance{0}, boundNumRels{0} {}
+
+    void resetState() final;
+    bool isComplete() final;
+
+    void markSrc(common::nodeID_t nodeID) final;
+    // Rels are relaxed with their weight, see relaxRel.
+    void markVisited(common::nodeID_t /*boundNodeID*/, common::nodeID_t /*nbrNodeID*/,
+        common::relID_t /*relID*/, uint64_t /*multiplicity*/) final {
+        KU_UNREACHABLE;
+    }
+
+    // Settles the unsettled node closest to src. Must not be called once complete.
+    common::nodeID_t settleNextNode();
+    // Relaxes a rel from the last settled node.
+    void relaxRel(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID, common::relID_t relID,
+        double weight);
+    // Lays out the cheapest paths found as the frontiers of a BFS from src.
+    void populatePathFrontiers();
+
+private:
+    bool trackPath;
+    frontier::NodeIDMap<NodeState> nodeStates;
+    // Min-heap of the nodes to settle. A node is pushed again each time its distance decreases, so
+    // the entries of settled nodes are skipped.
+    std::priority_queue<queue_entry_t, std::vector<queue_entry_t>, std::greater<>> queue;
+    std::vector<common::nodeID_t> settledNodeIDs;
+    uint64_t numSettledDstNodes;
+    // Distance and number of rels of the last settled node.
+    double boundDistance;
+    uint64_t boundNumRels;
+};
+
+} // namespace processor
+} // namespace kuzu
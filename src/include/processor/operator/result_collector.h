@@ -56,9 +56,20 @@ public:
 
     void finalize(ExecutionContext* context) final;
 
+    // Appends the tuples of the next getNextTuple() call of the child to the given table. Returns
+    // false once the child is exhausted. Results are streamed by calling it directly instead of
+    // executing the sink.
+    bool collectNextTuples(FactorizedTable& table, ExecutionContext* context);
+    // Number of flat tuples appended by the last successful collectNextTuples() call.
+    uint64_t getNumFlatTuplesCollected() const {
+        return unflatDataChunksPos.empty() ? resultSet->multiplicity :
+                                             resultSet->getNumTuples(unflatDataChunksPos);
+    }
+
     inline std::shared_ptr<FactorizedTable> getResultFactorizedTable() {
         return sharedState->getTable();
     }
+    inline common::AccumulateType getAccumulateType() const { return info->accumulateType; }
 
     std::unique_ptr<PhysicalOperator> clone() final {
         return make_unique<ResultCollector>(resultSetDescriptor->copy(), info->copy(), sharedState,
@@ -72,6 +83,7 @@ private:
     std::unique_ptr<ResultCollectorInfo> info;
     std::shared_ptr<ResultCollectorSharedState> sharedState;
     std::vector<common::ValueVector*> payloadVectors;
+    std::unordered_set<uint32_t> unflatDataChunksPos;
     std::unique_ptr<FactorizedTable> localTable;
 };
 
@@ -2,6 +2,8 @@
 
 #include <utility>
 
+#include "processor/operator/filtering_operator.h"
+#include "processor/operator/hash_join/bloom_filter.h"
 #include "processor/operator/scan/scan_table.h"
 #include "storage/store/node_table.h"
 
@@ -11,18 +13,28 @@ namespace processor {
 struct ScanNodeTableInfo {
     storage::NodeTable* table;
     std::vector<common::column_id_t> columnIDs;
+    // Predicates evaluated by a filter above the scan. Input node groups which cannot satisfy them
+    // are skipped based on column chunk statistics.
+    std::vector<storage::ColumnPredicate> predicates;
+    // Bloom filter of the build side keys of a hash join probed with the scanned nodes on the
+    // output vector at bloomFilterKeyIdx. Nodes whose key is not in the filter are dropped.
+    std::shared_ptr<BloomFilter> bloomFilter;
+    uint32_t bloomFilterKeyIdx;
 
-    ScanNodeTableInfo(storage::NodeTable* table, std::vector<common::column_id_t> columnIDs)
-        : table{table}, columnIDs{std::move(columnIDs)} {}
+    ScanNodeTableInfo(storage::NodeTable* table, std::vector<common::column_id_t> columnIDs,
+        std::vector<storage::ColumnPredicate> predicates = {})
+        : table{table}, columnIDs{std::move(columnIDs)}, predicates{std::move(predicates)},
+          bloomFilterKeyIdx{0} {}
     ScanNodeTableInfo(const ScanNodeTableInfo& other)
-        : table{other.table}, columnIDs{other.columnIDs} {}
+        : table{other.table}, columnIDs{other.columnIDs}, predicates{other.predicates},
+          bloomFilter{other.bloomFilter}, bloomFilterKeyIdx{other.bloomFilterKeyIdx} {}
 
     inline std::unique_ptr<ScanNodeTableInfo> copy() const {
         return std::make_unique<ScanNodeTableInfo>(*this);
     }
 };
 
-class ScanSingleNodeTable : public ScanTable {
+class ScanSingleNodeTable : public ScanTable, public SelVectorOverWriter {
 public:
     ScanSingleNodeTable(std::unique_ptr<ScanNodeTableInfo> info, const DataPos& inVectorPos,
         std::vector<DataPos> outVectorsPos, std::unique_ptr<PhysicalOperator> child, uint32_t id,
@@ -30,15 +42,15 @@ public:
         : ScanSingleNodeTable{PhysicalOperatorType::SCAN_NODE_TABLE, std::move(info), inVectorPos,
               std::move(outVectorsPos), std::move(child), id, paramsString} {}
 
-    inline void initLocalStateInternal(ResultSet* resultSet,
-        ExecutionContext* executionContext) final {
-        ScanTable::initLocalStateInternal(resultSet, executionContext);
-        readState =
-            std::make_unique<storage::TableReadState>(*inVector, info->columnIDs, outVectors);
-    }
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* executionContext) final;
 
     bool getNextTuplesInternal(ExecutionContext* context) override;
 
+    inline void setBloomFilter(std::shared_ptr<BloomFilter> bloomFilter, uint32_t keyIdx) {
+        info->bloomFilter = std::move(bloomFilter);
+        info->bloomFilterKeyIdx = keyIdx;
+    }
+
     inline std::unique_ptr<PhysicalOperator> clone() override {
         return make_unique<ScanSingleNodeTable>(info->copy(), inVectorPos, outVectorsPos,
             children[0]->clone(), id, paramsString);
@@ -52,9 +64,16 @@ protected:
               paramsString},
           info{std::move(info)} {}
 
+private:
+    bool canSkipInput(transaction::Transaction* transaction) const;
+    void scan(ExecutionContext* context);
+    // Returns false if no scanned node passes the bloom filter.
+    bool applyBloomFilter();
+
 private:
     std::unique_ptr<ScanNodeTableInfo> info;
     std::unique_ptr<storage::TableReadState> readState;
+    std::unique_ptr<common::ValueVector> keyHashVector;
 };
 
 } // namespace processor
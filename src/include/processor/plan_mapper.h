@@ -1,11 +1,14 @@
 #pragma once
 
+#include <functional>
+
 #include "common/enums/rel_direction.h"
 #include "expression_mapper.h"
 #include "function/aggregate_function.h"
 #include "planner/operator/logical_plan.h"
 #include "processor/operator/result_collector.h"
 #include "processor/physical_plan.h"
+#include "storage/stats/column_chunk_stats.h"
 
 namespace kuzu {
 namespace main {
@@ -21,6 +24,7 @@ class LogicalCopyFrom;
 namespace processor {
 
 class HashJoinBuildInfo;
+class HashJoinSharedState;
 struct AggregateInputInfo;
 class NodeInsertExecutor;
 class RelInsertExecutor;
@@ -172,6 +176,16 @@ private:
     inline uint32_t getOperatorID() { return physicalOperatorID++; }
 
     static void mapSIPJoin(PhysicalOperator* probe);
+    // Passes the bloom filter of the build side keys to the probe side scan of the key.
+    void mapBloomFilterScan(planner::LogicalOperator* logicalScan, const binder::Expression& key,
+        HashJoinSharedState& sharedState);
+
+    // Converts predicates of the form `column <comparison> literal` into column predicates that can
+    // be checked against statistics. getColumnID returns INVALID_COLUMN_ID for expressions that are
+    // not a scanned column. Other predicates are ignored.
+    static std::vector<storage::ColumnPredicate> getColumnPredicates(
+        const binder::expression_vector& predicates,
+        const std::function<common::column_id_t(const binder::Expression&)>& getColumnID);
 
     static std::vector<DataPos> getExpressionsDataPos(const binder::expression_vector& expressions,
         const planner::Schema& schema);
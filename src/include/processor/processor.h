@@ -2,6 +2,7 @@
 
 #include "common/task_system/task_scheduler.h"
 #include "processor/physical_plan.h"
+#include "processor/processor_task.h"
 #include "processor/result/factorized_table.h"
 
 namespace kuzu {
@@ -13,8 +14,14 @@ public:
     explicit QueryProcessor(uint64_t numThreads);
 
     std::shared_ptr<FactorizedTable> execute(PhysicalPlan* physicalPlan, ExecutionContext* context);
+    // Executes the pipelines that the root pipeline of the plan depends on, but not the root
+    // pipeline, whose tuples are then pulled through a ResultStream.
+    void executeDependencies(PhysicalPlan* physicalPlan, ExecutionContext* context);
 
 private:
+    std::shared_ptr<ProcessorTask> decomposePlan(PhysicalPlan* physicalPlan,
+        ExecutionContext* context);
+
     void decomposePlanIntoTask(PhysicalOperator* op, common::Task* task, ExecutionContext* context);
 
     void initTask(common::Task* task);
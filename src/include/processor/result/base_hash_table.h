@@ -15,6 +15,11 @@ public:
 
     virtual ~BaseHashTable() = default;
 
+    // Unpinned hash tables can be spilled to disk by the memory manager, and must be pinned again
+    // before they are accessed.
+    virtual void pinBuffers();
+    virtual void unpinBuffers();
+
 protected:
     uint64_t getSlotIdxForHash(common::hash_t hash) const { return hash & bitmask; }
     void setMaxNumHashSlots(uint64_t newSize);
@@ -48,6 +48,8 @@ public:
     inline void resetToZero() {
         memset(block->buffer, 0, common::BufferPoolConstants::PAGE_256KB_SIZE);
     }
+    inline void pin() { block->pin(); }
+    inline void unpin() { block->unpin(); }
 
     static void copyTuples(DataBlock* blockToCopyFrom, ft_tuple_idx_t tupleIdxToCopyFrom,
         DataBlock* blockToCopyInto, ft_tuple_idx_t tupleIdxToCopyTo, uint32_t numTuplesToCopy,
@@ -84,6 +86,8 @@ public:
     inline DataBlock* getBlock(ft_block_idx_t blockIdx) { return blocks[blockIdx].get(); }
 
     void merge(DataBlockCollection& other);
+    void pinBlocks();
+    void unpinBlocks();
 
 private:
     uint32_t numBytesPerTuple;
@@ -211,6 +215,10 @@ public:
     // other factorizedTable.
     void mergeMayContainNulls(FactorizedTable& other);
     void merge(FactorizedTable& other);
+    // Unpinned tables can be spilled to disk by the memory manager, and must be pinned again
+    // before they are accessed.
+    void pinBuffers();
+    void unpinBuffers();
 
     inline common::InMemOverflowBuffer* getInMemOverflowBuffer() const {
         return inMemOverflowBuffer.get();
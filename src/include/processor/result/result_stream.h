@@ -0,0 +1,54 @@
+#pragma once
+
+#include "processor/execution_context.h"
+#include "processor/operator/result_collector.h"
+#include "processor/physical_plan.h"
+
+namespace kuzu {
+namespace processor {
+
+/*
+ * ResultStream pulls the tuples of the root pipeline of a plan on the calling thread, one chunk at
+ * a time, instead of collecting all of them before the first one is read. The pipelines the root
+ * pipeline depends on (e.g. hash join builds and order by) must already be executed, see
+ * QueryProcessor::executeDependencies.
+ *
+ * Chunks are pulled into the shared table of the result collector, which is not used otherwise.
+ * Once the pipeline is exhausted the plan is released, but the table stays readable.
+ */
+class ResultStream {
+public:
+    ResultStream(std::unique_ptr<PhysicalPlan> physicalPlan,
+        std::unique_ptr<common::Profiler> profiler,
+        std::unique_ptr<ExecutionContext> executionContext);
+
+    std::shared_ptr<FactorizedTable> getTable() const { return table; }
+    bool isExhausted() const { return physicalPlan == nullptr; }
+    // Number of flat tuples pulled so far, including the ones in the table.
+    uint64_t getNumTuplesPulled() const { return numTuplesPulled; }
+
+    // Replaces the tuples in the table with the next chunk of at least MIN_NUM_TUPLES_PER_CHUNK
+    // flat tuples, unless the pipeline gets exhausted first.
+    void pullNextChunk();
+    // Appends all remaining tuples to the table.
+    void pullAllTuples();
+    // Releases the plan and the state of its operators.
+    void close();
+
+private:
+    void pullTuples(uint64_t minNumTuples);
+
+private:
+    static constexpr uint64_t MIN_NUM_TUPLES_PER_CHUNK = common::DEFAULT_VECTOR_CAPACITY;
+
+    std::unique_ptr<PhysicalPlan> physicalPlan;
+    std::unique_ptr<common::Profiler> profiler;
+    std::unique_ptr<ExecutionContext> executionContext;
+    ResultCollector* resultCollector;
+    std::unique_ptr<ResultSet> resultSet;
+    std::shared_ptr<FactorizedTable> table;
+    uint64_t numTuplesPulled;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -107,10 +107,11 @@ private:
  * constants.h), which is usually much larger than `maxSize`, and is expected to be large enough to
  * contain all disk pages. Each disk page in database files is directly mapped to a unique
  * PAGE_4KB_SIZE frame in the region.
- * 2) For each BMFileHandle backed by a temp in-mem file in MM, BM allocates a virtual memory region
- * of `maxSize` for it. Each memory buffer is mapped to a unique PAGE_256KB_SIZE frame in that
- * region. Both disk pages and memory buffers are all managed by the BM to make sure that actually
- * used physical memory doesn't go beyond max size specified by users. Currently, the BM uses a
+ * 2) For the BMFileHandle of MM, BM allocates a virtual memory region of `maxSize`, or of the
+ * max DB size if larger, since MM can hold more buffers than fit in memory when it spills unpinned
+ * buffers to disk. Each memory buffer is mapped to a unique PAGE_256KB_SIZE frame in that region.
+ * Both disk pages and memory buffers are all managed by the BM to make sure that actually used
+ * physical memory doesn't go beyond max size specified by users. Currently, the BM uses a
  * queue based replacement policy and the MADV_DONTNEED hint to explicitly control evictions. See
  * comments above `claimAFrame()` for more details.
  *
@@ -173,10 +174,20 @@ public:
         const std::function<void(uint8_t*)>& func);
     // The function assumes that the requested page is already pinned.
     void unpin(BMFileHandle& fileHandle, common::page_idx_t pageIdx);
+    // Loads the evicted pages among [startPageIdx, startPageIdx + numPages) with a single batch of
+    // reads, so that a scan over them waits on the disk once rather than once per page. Runs of
+    // consecutive pages are read with one large read each. Pages that are already in frames or
+    // locked by other threads are skipped, and prefetching stops early, without an error, when no
+    // more frames can be claimed.
+    void prefetchPages(BMFileHandle& fileHandle, common::page_idx_t startPageIdx,
+        common::page_idx_t numPages);
+
+    // Writes the dirty frames of the file back to disk and marks them clean, keeping the pages
+    // cached. Pages are pinned while being written, so other threads may read the file meanwhile.
+    void writeBackDirtyPages(BMFileHandle& fileHandle);
 
     // Currently, these functions are specifically used only for WAL files.
     void removeFilePagesFromFrames(BMFileHandle& fileHandle);
-    void flushAllDirtyPagesInFrames(BMFileHandle& fileHandle);
     void updateFrameIfPageIsInFrameWithoutLock(BMFileHandle& fileHandle, uint8_t* newPage,
         common::page_idx_t pageIdx);
     void removePageFromFrameIfNecessary(BMFileHandle& fileHandle, common::page_idx_t pageIdx);
@@ -194,6 +205,9 @@ public:
     inline void clearEvictionQueue() { evictionQueue = std::make_unique<EvictionQueue>(); }
 
 private:
+    // A single call to prefetchPages claims at most this fraction of the buffer pool.
+    static constexpr uint64_t MAX_PREFETCH_BUFFER_POOL_FRACTION = 8;
+
     static void verifySizeParams(uint64_t bufferPoolSize, uint64_t maxDBSize);
 
     bool claimAFrame(BMFileHandle& fileHandle, common::page_idx_t pageIdx,
@@ -4,6 +4,7 @@
 #include <memory>
 #include <mutex>
 #include <stack>
+#include <string>
 
 #include "common/types/types.h"
 
@@ -23,28 +24,44 @@ public:
     MemoryBuffer(MemoryAllocator* allocator, common::page_idx_t blockIdx, uint8_t* buffer);
     ~MemoryBuffer();
 
+    // Allows the buffer to be evicted, and written to the spill file of its allocator if the
+    // buffer pool runs out of memory. The buffer must not be accessed until it is pinned again.
+    // Does nothing if the allocator cannot spill.
+    void unpin();
+    // Reads the buffer back if it was evicted. The buffer keeps its address, so pointers into it
+    // remain valid.
+    void pin();
+
 public:
     uint8_t* buffer;
     common::page_idx_t pageIdx;
     MemoryAllocator* allocator;
+    bool isPinned;
 };
 
 class MemoryAllocator {
     friend class MemoryBuffer;
 
 public:
-    explicit MemoryAllocator(BufferManager* bm, common::VirtualFileSystem* vfs);
+    // Buffers are backed by a temp in-mem file, unless a spill file path is given.
+    explicit MemoryAllocator(BufferManager* bm, common::VirtualFileSystem* vfs,
+        std::string spillFilePath = "");
     ~MemoryAllocator();
 
     std::unique_ptr<MemoryBuffer> allocateBuffer(bool initializeToZero = false);
     inline common::page_offset_t getPageSize() const { return pageSize; }
+    inline bool canSpill() const { return !spillFilePath.empty(); }
 
 private:
-    void freeBlock(common::page_idx_t pageIdx);
+    void freeBlock(common::page_idx_t pageIdx, bool isPinned);
+    void unpinBlock(common::page_idx_t pageIdx);
+    void pinBlock(common::page_idx_t pageIdx);
 
 private:
     std::unique_ptr<BMFileHandle> fh;
     BufferManager* bm;
+    common::VirtualFileSystem* vfs;
+    std::string spillFilePath;
     common::page_offset_t pageSize;
     std::stack<common::page_idx_t> freePages;
     std::mutex allocatorLock;
@@ -62,19 +79,26 @@ private:
  * thread-safe, so that multiple threads can allocate/reclaim memory blocks with the same size class
  * at the same time.
  *
+ * When the MM is given a spill file, the BMFileHandle is backed by that file instead. A buffer that
+ * is unpinned by its owner is then written to the spill file if it gets evicted, and read back when
+ * it is pinned again, so operators can hold more intermediate data than fits in the buffer pool.
+ *
  * MM will return a MemoryBuffer to the caller, which is a wrapper of the allocated memory block,
  * and it will automatically call its allocator to reclaim the memory block when it is destroyed.
  */
 class MemoryManager {
 public:
-    explicit MemoryManager(BufferManager* bm, common::VirtualFileSystem* vfs) : bm{bm} {
-        allocator = std::make_unique<MemoryAllocator>(bm, vfs);
+    explicit MemoryManager(BufferManager* bm, common::VirtualFileSystem* vfs,
+        std::string spillFilePath = "")
+        : bm{bm} {
+        allocator = std::make_unique<MemoryAllocator>(bm, vfs, std::move(spillFilePath));
     }
 
     inline std::unique_ptr<MemoryBuffer> allocateBuffer(bool initializeToZero = false) {
         return allocator->allocateBuffer(initializeToZero);
     }
     inline BufferManager* getBufferManager() const { return bm; }
+    inline bool canSpill() const { return allocator->canSpill(); }
 
 private:
     BufferManager* bm;
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+
+namespace kuzu {
+namespace storage {
+
+struct BitpackHeader;
+
+// Implementations of unpackChunks. All of them produce the same output; the vectorized kernels
+// are only used when the CPU supports them.
+enum class UnpackKernel : uint8_t {
+    // fastunpack followed by sign extension and the frame of reference
+    SCALAR = 0,
+    AVX2 = 1,
+    AVX512 = 2,
+};
+
+bool isUnpackKernelSupported(UnpackKernel kernel);
+// The fastest kernel supported by the CPU, detected once at runtime.
+UnpackKernel getBestUnpackKernel();
+
+// Unpacks the 32 values of the chunk at `in`, using the same layout as FastPForLib::fastpack.
+template<typename T>
+void fastunpack(const uint8_t* in, T* out, uint32_t bitWidth);
+
+// Unpacks numChunks consecutive chunks of 32 bitpacked values into `out`, sign extending them if
+// the header has negative values and adding the header's offset, in a single pass over the
+// output.
+template<typename T>
+void unpackChunks(const uint8_t* in, T* out, uint64_t numChunks, const BitpackHeader& header,
+    UnpackKernel kernel);
+
+template<typename T>
+inline void unpackChunks(const uint8_t* in, T* out, uint64_t numChunks,
+    const BitpackHeader& header) {
+    unpackChunks(in, out, numChunks, header, getBestUnpackKernel());
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -28,6 +28,9 @@ enum class CompressionType : uint8_t {
     INTEGER_BITPACKING = 1,
     BOOLEAN_BITPACKING = 2,
     CONSTANT = 3,
+    DELTA_BITPACKING = 4,
+    RUN_LENGTH = 5,
+    ALP = 6,
 };
 
 struct CompressionMetadata {
@@ -271,6 +274,116 @@ protected:
     }
 };
 
+// Delta encoding, augmented with Frame of Reference encoding of the deltas.
+// Pages are split into blocks of BLOCK_SIZE values. Each block begins with its first value stored
+// uncompressed, followed by the differences between consecutive values, minus the smallest
+// difference (stored as the header offset), bitpacked like IntegerBitpacking. Sorted values with a
+// regular stride, such as CSR offsets, sequential IDs and timestamps, need only a few bits per
+// value.
+// Since each value depends on the ones before it in its block, values can't be updated in-place
+// and reading a value requires decoding its block from the beginning.
+template<typename T>
+class DeltaBitpacking : public CompressionAlg {
+    using U = std::make_unsigned_t<T>;
+    // This is an implementation detail of the fastpfor bitpacking algorithm
+    static constexpr uint64_t CHUNK_SIZE = 32;
+    // Bounds the number of values which need to be decoded to read a single value
+    static constexpr uint64_t BLOCK_SIZE = 512;
+
+public:
+    DeltaBitpacking() = default;
+    DeltaBitpacking(const DeltaBitpacking&) = default;
+
+    // Shouldn't be used. CompressionMetadata::canUpdateInPlace is always false for delta encoding
+    void setValuesFromUncompressed(const uint8_t*, common::offset_t, uint8_t*, common::offset_t,
+        common::offset_t, const CompressionMetadata&) const override {
+        KU_UNREACHABLE;
+    }
+
+    static BitpackHeader getHeader(const uint8_t* srcBuffer, uint64_t numValues);
+
+    static inline uint64_t numValues(uint64_t dataSize, const BitpackHeader& header) {
+        KU_ASSERT(header.bitWidth > 0);
+        auto blockSize = getBlockSizeInBytes(header.bitWidth);
+        auto numValues = dataSize / blockSize * BLOCK_SIZE;
+        // The remaining space can hold a partial block
+        auto remainingSize = dataSize % blockSize;
+        if (remainingSize > sizeof(T)) {
+            auto numValuesInLastBlock = (remainingSize - sizeof(T)) * 8 / header.bitWidth;
+            // Round down to nearest multiple of CHUNK_SIZE so that packing full chunks stays
+            // within the page.
+            numValues += numValuesInLastBlock - numValuesInLastBlock % CHUNK_SIZE;
+        }
+        return numValues;
+    }
+
+    CompressionMetadata getCompressionMetadata(const uint8_t* srcBuffer,
+        uint64_t numValues) const override {
+        return CompressionMetadata(CompressionType::DELTA_BITPACKING,
+            getHeader(srcBuffer, numValues).getData());
+    }
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const final;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const final;
+
+private:
+    static inline uint64_t getBlockSizeInBytes(uint8_t bitWidth) {
+        return sizeof(T) + BLOCK_SIZE * bitWidth / 8;
+    }
+};
+
+// Run-length encoding.
+// Each page stores the number of runs as a uint32_t, followed by the end position (exclusive,
+// relative to the start of the page) of each run as a uint16_t and then the value of each run.
+// The number of values per page is fixed for a chunk so that positions can be mapped to pages. It
+// is chosen when analyzing the data so that the runs within each page fit, and is stored in the
+// first four bytes of the metadata.
+// Like delta encoding, values can't be updated in-place.
+class RunLengthEncoding : public CompressionAlg {
+public:
+    // Must fit in the uint16_t run ends
+    static constexpr uint64_t MAX_VALUES_PER_PAGE = 32768;
+
+    explicit RunLengthEncoding(const common::LogicalType& logicalType)
+        : numBytesPerValue{getDataTypeSizeInChunk(logicalType)} {}
+    explicit RunLengthEncoding(uint32_t numBytesPerValue) : numBytesPerValue{numBytesPerValue} {}
+    RunLengthEncoding(const RunLengthEncoding&) = default;
+
+    // Shouldn't be used. CompressionMetadata::canUpdateInPlace is always false for run-length
+    // encoding
+    void setValuesFromUncompressed(const uint8_t*, common::offset_t, uint8_t*, common::offset_t,
+        common::offset_t, const CompressionMetadata&) const override {
+        KU_UNREACHABLE;
+    }
+
+    static uint64_t numValues(const CompressionMetadata& metadata);
+
+    // Picks the largest number of values per page for which the runs of every page fit.
+    CompressionMetadata getCompressionMetadata(const uint8_t* srcBuffer,
+        uint64_t numValues) const override;
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const final;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues, const CompressionMetadata& metadata) const final;
+
+private:
+    inline bool isSameValue(const uint8_t* buffer, uint64_t pos1, uint64_t pos2) const {
+        return memcmp(buffer + pos1 * numBytesPerValue, buffer + pos2 * numBytesPerValue,
+                   numBytesPerValue) == 0;
+    }
+
+private:
+    uint32_t numBytesPerValue;
+};
+
 class BooleanBitpacking : public CompressionAlg {
 public:
     BooleanBitpacking() = default;
@@ -297,17 +410,123 @@ public:
         uint64_t dstOffset, uint64_t numValues, const CompressionMetadata& metadata) const;
 };
 
+// Compresses integers with whichever of integer bitpacking, delta encoding and run-length encoding
+// stores the chunk in the fewest pages. Delta and run-length encoded chunks can't be updated
+// in-place, so they are only chosen when they need at most half as many pages as bitpacking.
+template<typename T>
+class IntegerCompression final : public CompressionAlg {
+public:
+    IntegerCompression() : uncompressed{sizeof(T)}, runLength{sizeof(T)} {}
+    IntegerCompression(const IntegerCompression&) = default;
+
+    void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
+        uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
+        const CompressionMetadata& metadata) const override {
+        getAlg(metadata).setValuesFromUncompressed(srcBuffer, srcOffset, dstBuffer, dstOffset,
+            numValues, metadata);
+    }
+
+    CompressionMetadata getCompressionMetadata(const uint8_t* srcBuffer,
+        uint64_t numValues) const override;
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const override {
+        return getAlg(metadata).compressNextPage(srcBuffer, numValuesRemaining, dstBuffer,
+            dstBufferSize, metadata);
+    }
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const override {
+        getAlg(metadata).decompressFromPage(srcBuffer, srcOffset, dstBuffer, dstOffset, numValues,
+            metadata);
+    }
+
+private:
+    const CompressionAlg& getAlg(const CompressionMetadata& metadata) const;
+
+private:
+    Uncompressed uncompressed;
+    IntegerBitpacking<T> bitpacking;
+    DeltaBitpacking<T> delta;
+    RunLengthEncoding runLength;
+};
+
+// Serialized as nine bytes.
+// The first byte is the decimal exponent, the second the bit width and the third the number of
+// exceptions which can be stored in each page.
+// The remaining six bytes store the offset as a 48-bit signed integer.
+struct ALPHeader {
+    uint8_t exponent;
+    uint8_t bitWidth;
+    uint8_t exceptionCapacity;
+    // Offset (frame of reference) of the encoded integers
+    int64_t offset;
+    static constexpr uint8_t OFFSET_SIZE = 6;
+
+    std::array<uint8_t, CompressionMetadata::DATA_SIZE> getData() const;
+
+    static ALPHeader readHeader(const std::array<uint8_t, CompressionMetadata::DATA_SIZE>& data);
+};
+
+// Lossless floating point compression in the style of ALP (Adaptive Lossless floating-Point).
+// Values are multiplied by 10^exponent and stored as integers with Frame of Reference bitpacking,
+// if dividing the integer by 10^exponent gives back exactly the same value. This holds for most
+// data which originates from decimals, e.g. prices and measurements. The exponent is chosen per
+// chunk from a sample of its values.
+// Values which can't be encoded this way are stored uncompressed as exceptions. Each page begins
+// with the number of exceptions in the page (uint32_t), followed by the bitpacked integers and then
+// the positions (uint16_t) and values of the exceptions. The number of values per page is chosen
+// so that the exceptions of every page fit.
+template<typename T>
+class FloatCompression : public CompressionAlg {
+    static_assert(std::is_floating_point_v<T>);
+    static constexpr uint8_t MAX_EXPONENT = std::is_same_v<T, double> ? 18 : 10;
+    static constexpr uint64_t MAX_VALUES_PER_PAGE = 32768;
+
+public:
+    FloatCompression() = default;
+    FloatCompression(const FloatCompression&) = default;
+
+    void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
+        uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
+        const CompressionMetadata& metadata) const final;
+
+    static uint64_t numValues(uint64_t dataSize, const ALPHeader& header);
+
+    // Falls back to uncompressed if ALP doesn't reduce the number of pages needed
+    CompressionMetadata getCompressionMetadata(const uint8_t* srcBuffer,
+        uint64_t numValues) const override;
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const final;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const final;
+
+    static bool canUpdateInPlace(T value, const ALPHeader& header);
+
+private:
+    // Returns false if the value can't be encoded losslessly with the given exponent
+    static bool encode(T value, uint8_t exponent, int64_t& result);
+    static inline T decode(int64_t value, uint8_t exponent);
+};
+
 class CompressedFunctor {
 public:
     CompressedFunctor(const CompressedFunctor&) = default;
 
 protected:
     explicit CompressedFunctor(const common::LogicalType& logicalType)
-        : constant{logicalType}, uncompressed{logicalType},
+        : constant{logicalType}, uncompressed{logicalType}, runLength{logicalType},
           physicalType{logicalType.getPhysicalType()} {}
     const ConstantCompression constant;
     const Uncompressed uncompressed;
     const BooleanBitpacking booleanBitpacking;
+    const RunLengthEncoding runLength;
     const common::PhysicalTypeID physicalType;
 };
 
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "common/enums/expression_type.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace storage {
+
+class NullColumnChunk;
+
+// Physical representation of a value used by column chunk statistics. Wide enough to hold any of
+// the fixed-sized numeric physical types we keep statistics for.
+union StorageValue {
+    int64_t signedInt;
+    uint64_t unsignedInt;
+    double floatVal;
+
+    StorageValue() : unsignedInt{0} {}
+
+    template<typename T>
+    static StorageValue fromValue(T value) {
+        StorageValue result;
+        if constexpr (std::is_floating_point_v<T>) {
+            result.floatVal = value;
+        } else if constexpr (std::is_signed_v<T>) {
+            result.signedInt = value;
+        } else {
+            result.unsignedInt = value;
+        }
+        return result;
+    }
+
+    // Both values are interpreted as the given physical type.
+    bool gt(const StorageValue& other, common::PhysicalTypeID physicalType) const;
+};
+
+// Min/max (zone map) of the non-null values stored in a column chunk. Stats are only maintained
+// for fixed-sized numeric physical types. When `hasStats` is false, nothing is known about the
+// values in the chunk and the chunk can never be skipped.
+// Note: this is stored inside ColumnChunkMetadata in a disk array, so it must remain trivially
+// copyable.
+struct ColumnChunkStats {
+    StorageValue min;
+    StorageValue max;
+    bool hasStats = false;
+
+    static bool isSupported(common::PhysicalTypeID physicalType);
+
+    // Computes the stats of the first numValues values in an uncompressed buffer, ignoring values
+    // marked null in nullChunk (if not null).
+    static ColumnChunkStats compute(const uint8_t* data, const NullColumnChunk* nullChunk,
+        uint64_t numValues, common::PhysicalTypeID physicalType);
+
+    // Widens the stats to include numValues values starting at srcOffset in an uncompressed
+    // buffer. Stats that are unknown stay unknown. Returns true if the stats changed.
+    bool update(const uint8_t* data, common::offset_t srcOffset, uint64_t numValues,
+        common::PhysicalTypeID physicalType);
+
+private:
+    bool update(StorageValue value, common::PhysicalTypeID physicalType);
+};
+
+// A comparison between a column and a constant (e.g. `a.age > 30`) that can be checked against
+// column chunk statistics to skip node groups during scans.
+struct ColumnPredicate {
+    common::column_id_t columnID;
+    // One of EQUALS, GREATER_THAN, GREATER_THAN_EQUALS, LESS_THAN and LESS_THAN_EQUALS, with the
+    // column on the left hand side.
+    common::ExpressionType comparisonType;
+    StorageValue value;
+
+    ColumnPredicate(common::column_id_t columnID, common::ExpressionType comparisonType,
+        StorageValue value)
+        : columnID{columnID}, comparisonType{comparisonType}, value{value} {}
+
+    // Returns true if no value within the stats' range can satisfy the predicate.
+    bool canSkip(const ColumnChunkStats& stats, common::PhysicalTypeID physicalType) const;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -23,6 +23,9 @@ public:
     void prepareRollback(transaction::Transaction* transaction);
     void checkpointInMemory();
     void rollbackInMemory();
+    // Writes the changes that were committed to the frames of the buffer manager back to the
+    // database files.
+    void writeBackDirtyPages();
 
     PrimaryKeyIndex* getPKIndex(common::table_id_t tableID);
 
@@ -35,6 +35,9 @@ class Column {
     friend class ListColumn;
 
 public:
+    // Number of pages (2MB) that sequential scans read ahead at a time.
+    static constexpr common::page_idx_t READ_AHEAD_NUM_PAGES = 512;
+
     struct ReadState {
         ColumnChunkMetadata metadata;
         uint64_t numValuesPerPage;
@@ -133,6 +136,10 @@ protected:
     virtual void lookupValue(transaction::Transaction* transaction, common::offset_t nodeOffset,
         common::ValueVector* resultVector, uint32_t posInVector);
 
+    // Sequential scans load a column chunk into the buffer pool READ_AHEAD_NUM_PAGES pages at a
+    // time, with large contiguous reads, as they enter [startOffsetInChunk, endOffsetInChunk).
+    void readAhead(transaction::Transaction* transaction, const ColumnChunkMetadata& chunkMeta,
+        common::offset_t startOffsetInChunk, common::offset_t endOffsetInChunk);
     void readFromPage(transaction::Transaction* transaction, common::page_idx_t pageIdx,
         const std::function<void(uint8_t*)>& func);
 
@@ -71,6 +71,11 @@ public:
             *readState.dataReadState);
     }
     void read(transaction::Transaction* transaction, TableReadState& readState) override;
+    // Returns true if, based on column chunk statistics, no node in the node group can satisfy
+    // all the given predicates.
+    bool canSkipNodeGroup(transaction::Transaction* transaction,
+        common::node_group_idx_t nodeGroupIdx,
+        const std::vector<ColumnPredicate>& predicates) const;
 
     // Return the max node offset during insertions.
     common::offset_t validateUniquenessConstraint(transaction::Transaction* transaction,
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <condition_variable>
 #include <unordered_set>
 
 #include "storage/buffer_manager/buffer_manager.h"
@@ -85,6 +86,13 @@ public:
         flushHeaderPages();
         return make_unique<WALIterator>(fileHandle, mtx);
     }
+    // Returns an iterator over the records logged after the ones committed in memory.
+    inline std::unique_ptr<WALIterator> getIteratorAfterRecordsCommittedInMemory() {
+        lock_t lck{mtx};
+        flushHeaderPages();
+        return make_unique<WALIterator>(fileHandle, mtx, headerPageIdxAfterRecordsCommittedInMemory,
+            numRecordsCommittedInMemoryInHeaderPage);
+    }
 
     common::page_idx_t logPageUpdateRecord(DBFileID dbFileID,
         common::page_idx_t pageIdxInOriginalFile);
@@ -92,7 +100,18 @@ public:
     common::page_idx_t logPageInsertRecord(DBFileID dbFileID,
         common::page_idx_t pageIdxInOriginalFile);
 
+    // Writes the commit record and all the pages logged before it to the WAL file. The commit is
+    // only durable once syncCommits() returns.
     void logCommit(uint64_t transactionID);
+    // Number of commits logged since the WAL was opened. Unlike the record counts, it is not reset
+    // when the WAL is cleared.
+    inline uint64_t getNumCommitsLogged() {
+        lock_t lck{mtx};
+        return numCommitsLogged;
+    }
+    // Syncs the WAL file until the first numCommits logged commits are durable. Commits waiting
+    // while another thread syncs the file are synced together by the next sync.
+    void syncCommits(uint64_t numCommits);
 
     void logTableStatisticsRecord(bool isNodeTable);
 
@@ -118,6 +137,36 @@ public:
         return isLastLoggedRecordCommit_;
     }
 
+    inline uint64_t getNumRecords() {
+        lock_t lck{mtx};
+        return numRecords;
+    }
+    // Number of records up to and including the last logged commit record. Records after it
+    // belong to a transaction that has not committed.
+    inline uint64_t getNumRecordsUpToLastCommit() {
+        lock_t lck{mtx};
+        return numRecordsUpToLastCommit;
+    }
+    // Committed transactions can be applied to the frames of the buffer manager only, leaving
+    // their records in the WAL until the next checkpoint. The records of these transactions form a
+    // prefix of the WAL, which replaying the current write transaction skips.
+    inline uint64_t getNumRecordsCommittedInMemory() {
+        lock_t lck{mtx};
+        return numRecordsCommittedInMemory;
+    }
+    inline bool hasRecordsCommittedInMemory() { return getNumRecordsCommittedInMemory() > 0; }
+    void setRecordsCommittedInMemory();
+    // Whether the records logged since the last commit in memory only update pages and table
+    // statistics. Other records, e.g., of DDL and COPY statements, change files outside the buffer
+    // manager and can only be committed with a checkpoint.
+    inline bool canCommitInMemory() {
+        lock_t lck{mtx};
+        return !hasRecordsRequiringCheckpoint;
+    }
+    inline uint64_t getFileSize() const {
+        return fileHandle->getNumPages() * common::BufferPoolConstants::PAGE_4KB_SIZE;
+    }
+
     void flushAllPages();
 
     inline bool isEmptyWAL() {
@@ -141,7 +190,7 @@ private:
 
     void initCurrentPage();
     void addNewWALRecordNoLock(WALRecord& walRecord);
-    void setIsLastRecordCommit();
+    void initRecordCounts();
 
 private:
     // Node/Rel tables that might have changes to their in-memory data structures that need to be
@@ -151,11 +200,28 @@ private:
     std::mutex mtx;
     BufferManager& bufferManager;
     bool isLastLoggedRecordCommit_;
+    uint64_t numRecords;
+    uint64_t numRecordsUpToLastCommit;
+    uint64_t numRecordsCommittedInMemory;
+    // Position of the first record after the ones committed in memory, so that committing the
+    // next transaction does not read the header pages of the earlier ones.
+    common::page_idx_t headerPageIdxAfterRecordsCommittedInMemory;
+    uint64_t numRecordsCommittedInMemoryInHeaderPage;
+    bool hasRecordsRequiringCheckpoint;
+    uint64_t numCommitsLogged;
+    // Guards the fields below, which are only used to sync the WAL file.
+    std::mutex mtxForSyncing;
+    std::condition_variable cvForSyncing;
+    bool isSyncing;
+    uint64_t numCommitsSynced;
 };
 
 class WALIterator : public BaseWALAndWALIterator {
 public:
-    explicit WALIterator(std::shared_ptr<BMFileHandle> fileHandle, std::mutex& mtx);
+    // Iterates over the records starting from the numRecordsToSkip'th record of the given header
+    // page.
+    WALIterator(std::shared_ptr<BMFileHandle> fileHandle, std::mutex& mtx,
+        common::page_idx_t startHeaderPageIdx = 0, uint64_t numRecordsToSkip = 0);
 
     inline bool hasNextRecord() {
         lock_t lck{mtx};
@@ -168,6 +234,7 @@ private:
     inline bool hasNextRecordNoLock() {
         return numRecordsReadInCurrentHeaderPage < getNumRecordsInCurrentHeaderPage();
     }
+    void readNextHeaderPageIfNecessary();
 
 public:
     std::mutex& mtx;
@@ -11,7 +11,14 @@ namespace storage {
 
 class StorageManager;
 
-enum class WALReplayMode : uint8_t { COMMIT_CHECKPOINT, ROLLBACK, RECOVERY_CHECKPOINT };
+// COMMIT_IN_MEMORY redoes the committing transaction in the frames of the buffer manager without
+// writing the database files, which are updated by a later checkpoint.
+enum class WALReplayMode : uint8_t {
+    COMMIT_CHECKPOINT,
+    COMMIT_IN_MEMORY,
+    ROLLBACK,
+    RECOVERY_CHECKPOINT
+};
 
 // Note: This class is not thread-safe.
 class WALReplayer {
@@ -42,10 +49,17 @@ private:
         const PageUpdateOrInsertRecord& pageInsertOrUpdateRecord);
     BMFileHandle* getVersionedFileHandleIfWALVersionAndBMShouldBeCleared(const DBFileID& dbFileID);
     std::unique_ptr<catalog::Catalog> getCatalogForRecovery(common::FileVersionType dbFileType);
+    // The WAL versions of the catalog and statistics files may have been written by the
+    // uncommitted transaction. The committed transactions before it must have been committed in
+    // memory, which already copied their versions of these files over the original ones.
+    inline bool isRecoveringWithUncommittedRecords() const {
+        return isRecovering && wal->getNumRecords() > wal->getNumRecordsUpToLastCommit();
+    }
 
 private:
     bool isRecovering;
     bool isCheckpoint; // if true does redo operations; if false does undo operations
+    bool isInMemory;   // if true redo operations only update the buffer manager
     // Warning: Some fields of the storageManager may not yet be initialized if the WALReplayer
     // has been initialized during recovery, i.e., isRecovering=true.
     StorageManager* storageManager;
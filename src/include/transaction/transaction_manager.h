@@ -1,7 +1,10 @@
 #pragma once
 
+#include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <unordered_set>
 
 #include "storage/wal/wal.h"
@@ -19,7 +22,11 @@ class TransactionManager {
 
 public:
     explicit TransactionManager(storage::WAL& wal)
-        : wal{wal}, activeWriteTransactionID{INT64_MAX}, lastTransactionID{0}, lastCommitID{0} {};
+        : wal{wal}, activeWriteTransactionID{INT64_MAX}, lastTransactionID{0}, lastCommitID{0},
+          nextWriteTransactionTicket{0} {};
+    // Only one write transaction is active at a time. If there is one, new write transactions
+    // queue up and start in arrival order once it commits or rolls back. Waiting longer than the
+    // timeout throws a TransactionManagerException.
     std::unique_ptr<Transaction> beginWriteTransaction(main::ClientContext& clientContext);
     std::unique_ptr<Transaction> beginReadOnlyTransaction(main::ClientContext& clientContext);
     void commit(Transaction* transaction);
@@ -31,6 +38,15 @@ public:
     // stopNewTransactionsAndWaitUntilAllReadTransactionsLeave().
     void stopNewTransactionsAndWaitUntilAllReadTransactionsLeave();
     void allowReceivingNewTransactions();
+    // Checkpointing the changes of committed write transactions needs exclusive access to the WAL
+    // but not to the data read by read-only transactions. If there is no active write transaction,
+    // this function blocks new write transactions from starting until finishCheckpoint() is
+    // called and returns true. Otherwise, it returns false.
+    bool tryStartCheckpoint();
+    void finishCheckpoint();
+    // Same as stopNewTransactionsAndWaitUntilAllReadTransactionsLeave(), but returns false instead
+    // of waiting if there are active read transactions.
+    bool tryStopNewTransactionsIfNoActiveReadTransactions();
 
     // Warning: Below public functions are for tests only
     inline std::unordered_set<uint64_t>& getActiveReadOnlyTransactionIDs() {
@@ -48,6 +64,9 @@ public:
     inline void setCheckPointWaitTimeoutForTransactionsToLeaveInMicros(uint64_t waitTimeInMicros) {
         checkPointWaitTimeoutForTransactionsToLeaveInMicros = waitTimeInMicros;
     }
+    inline void setWaitTimeoutForWriteTransactionInMicros(uint64_t waitTimeInMicros) {
+        waitTimeoutForWriteTransactionInMicros = waitTimeInMicros;
+    }
 
 private:
     inline bool hasActiveWriteTransactionNoLock() const {
@@ -56,8 +75,14 @@ private:
     inline void clearActiveWriteTransactionIfWriteTransactionNoLock(Transaction* transaction) {
         if (transaction->isWriteTransaction()) {
             activeWriteTransactionID = INT64_MAX;
+            cvForWaitingWriteTransactions.notify_all();
         }
     }
+    inline bool canStartWriteTransactionNoLock(std::optional<uint64_t> ticket) const {
+        return !hasActiveWriteTransactionNoLock() &&
+               (waitingWriteTransactionTickets.empty() ||
+                   waitingWriteTransactionTickets.front() == ticket);
+    }
     void commitOrRollbackNoLock(Transaction* transaction, bool isCommit);
     void assertActiveWriteTransactionIsCorrectNoLock(Transaction* transaction) const;
 
@@ -82,8 +107,17 @@ private:
     // function, which needs to let calls to comming and rollback.
     std::mutex mtxForSerializingPublicFunctionCalls;
     std::mutex mtxForStartingNewTransactions;
+    // Held by a checkpoint for its whole duration. New write transactions wait on it.
+    std::mutex mtxForCheckpointing;
     uint64_t checkPointWaitTimeoutForTransactionsToLeaveInMicros =
         common::DEFAULT_CHECKPOINT_WAIT_TIMEOUT_FOR_TRANSACTIONS_TO_LEAVE_IN_MICROS;
+    // Write transactions waiting for the active one to finish, in arrival order. Guarded by
+    // mtxForSerializingPublicFunctionCalls.
+    std::deque<uint64_t> waitingWriteTransactionTickets;
+    uint64_t nextWriteTransactionTicket;
+    std::condition_variable cvForWaitingWriteTransactions;
+    uint64_t waitTimeoutForWriteTransactionInMicros =
+        common::DEFAULT_WAIT_TIMEOUT_FOR_WRITE_TRANSACTION_IN_MICROS;
 };
 } // namespace transaction
 } // namespace kuzu
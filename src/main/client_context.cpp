@@ -15,8 +15,10 @@
 #include "parser/visitor/statement_read_write_analyzer.h"
 #include "planner/operator/logical_plan_util.h"
 #include "planner/planner.h"
+#include "processor/operator/result_collector.h"
 #include "processor/plan_mapper.h"
 #include "processor/processor.h"
+#include "processor/result/result_stream.h"
 #include "storage/storage_manager.h"
 #include "transaction/transaction_context.h"
 
@@ -42,7 +44,7 @@ void ActiveQuery::reset() {
     timer = Timer();
 }
 
-ClientContext::ClientContext(Database* database) : database{database} {
+ClientContext::ClientContext(Database* database) : database{database}, streamingResult{nullptr} {
     progressBar = std::make_unique<common::ProgressBar>();
     transactionContext = std::make_unique<TransactionContext>(*this);
     randomEngine = std::make_unique<common::RandomEngine>();
@@ -55,10 +57,20 @@ ClientContext::ClientContext(Database* database) : database{database} {
     config.enableSemiMask = ClientConfigDefault::ENABLE_SEMI_MASK;
     config.numThreads = database->systemConfig.maxNumThreads;
     config.timeoutInMS = ClientConfigDefault::TIMEOUT_IN_MS;
+    config.queryPriority = ClientConfigDefault::QUERY_PRIORITY;
     config.varLengthMaxDepth = ClientConfigDefault::VAR_LENGTH_MAX_DEPTH;
+    config.shortestPathWeightProperty = "";
     config.enableProgressBar = ClientConfigDefault::ENABLE_PROGRESS_BAR;
     config.showProgressAfter = ClientConfigDefault::SHOW_PROGRESS_AFTER;
     config.enableMultiCopy = ClientConfigDefault::ENABLE_MULTI_COPY;
+    config.streamResults = ClientConfigDefault::STREAM_RESULTS;
+}
+
+ClientContext::~ClientContext() {
+    if (streamingResult != nullptr) {
+        // Tuples that were not read are discarded.
+        finishResultStreamNoLock(true /* success */);
+    }
 }
 
 uint64_t ClientContext::getTimeoutRemainingInMS() const {
@@ -284,6 +296,7 @@ std::unique_ptr<PreparedStatement> ClientContext::prepareNoLock(
     std::shared_ptr<Statement> parsedStatement, bool enumerateAllPlans,
     std::string_view encodedJoin, bool requireNewTx,
     std::optional<std::unordered_map<std::string, std::shared_ptr<common::Value>>> inputParams) {
+    closeResultStreamNoLock();
     auto preparedStatement = std::make_unique<PreparedStatement>();
     auto compilingTimer = TimeMetric(true /* enable */);
     compilingTimer.start();
@@ -303,8 +316,7 @@ std::unique_ptr<PreparedStatement> ClientContext::prepareNoLock(
                     preparedStatement->allowActiveTransaction(), preparedStatement->readOnly);
             }
             if (!this->getTx()->isReadOnly()) {
-                database->catalog->initCatalogContentForWriteTrxIfNecessary();
-                database->storageManager->initStatistics();
+                initWriteTransactionNoLock(*preparedStatement);
             }
         }
         // binding
@@ -406,11 +418,11 @@ std::unique_ptr<QueryResult> ClientContext::executeAndAutoCommitIfNecessaryNoLoc
     if (!preparedStatement->isSuccess()) {
         return queryResultWithError(preparedStatement->errMsg);
     }
+    closeResultStreamNoLock();
     if (preparedStatement->parsedStatement->requireTx() && requiredNexTx && getTx() == nullptr) {
         this->transactionContext->beginAutoTransaction(preparedStatement->isReadOnly());
         if (!preparedStatement->readOnly) {
-            database->catalog->initCatalogContentForWriteTrxIfNecessary();
-            database->storageManager->initStatistics();
+            initWriteTransactionNoLock(*preparedStatement);
         }
     }
     this->resetActiveQuery();
@@ -433,6 +445,24 @@ std::unique_ptr<QueryResult> ClientContext::executeAndAutoCommitIfNecessaryNoLoc
     profiler->enabled = preparedStatement->isProfile();
     auto executingTimer = TimeMetric(true /* enable */);
     executingTimer.start();
+    if (canStreamResult(preparedStatement, physicalPlan.get())) {
+        std::unique_ptr<ResultStream> resultStream;
+        try {
+            database->queryProcessor->executeDependencies(physicalPlan.get(),
+                executionContext.get());
+            resultStream = std::make_unique<ResultStream>(std::move(physicalPlan),
+                std::move(profiler), std::move(executionContext));
+        } catch (Exception& exception) {
+            this->transactionContext->rollback();
+            return queryResultWithError(std::string(exception.what()));
+        }
+        streamingResult = queryResult.get();
+        queryResult->initResultStream(std::move(resultStream),
+            preparedStatement->statementResult->getColumns(), this);
+        executingTimer.stop();
+        queryResult->querySummary->executionTime = executingTimer.getElapsedTimeMS();
+        return queryResult;
+    }
     std::shared_ptr<FactorizedTable> resultFT;
     try {
         if (preparedStatement->isTransactionStatement()) {
@@ -459,6 +489,47 @@ std::unique_ptr<QueryResult> ClientContext::executeAndAutoCommitIfNecessaryNoLoc
     return queryResult;
 }
 
+void ClientContext::initWriteTransactionNoLock(const PreparedStatement& preparedStatement) {
+    database->catalog->initCatalogContentForWriteTrxIfNecessary();
+    database->storageManager->initStatistics();
+    // DDL and COPY statements read and write parts of the database files directly, so the changes
+    // of transactions that were only committed in memory are written back first.
+    if (!preparedStatement.allowActiveTransaction() &&
+        database->wal->hasRecordsCommittedInMemory()) {
+        database->storageManager->writeBackDirtyPages();
+    }
+}
+
+bool ClientContext::canStreamResult(PreparedStatement* preparedStatement,
+    PhysicalPlan* physicalPlan) const {
+    if (!config.streamResults ||
+        preparedStatement->preparedSummary.statementType != StatementType::QUERY ||
+        !preparedStatement->isReadOnly()) {
+        return false;
+    }
+    // Optional results are only known once all tuples have been collected.
+    auto resultCollector =
+        ku_dynamic_cast<PhysicalOperator*, ResultCollector*>(physicalPlan->lastOperator.get());
+    return resultCollector->getAccumulateType() == AccumulateType::REGULAR;
+}
+
+void ClientContext::closeResultStreamNoLock() {
+    if (streamingResult != nullptr) {
+        streamingResult->materializeResultStream();
+    }
+}
+
+void ClientContext::finishResultStreamNoLock(bool success) {
+    KU_ASSERT(streamingResult != nullptr);
+    streamingResult->resultStream->close();
+    streamingResult = nullptr;
+    if (!success) {
+        transactionContext->rollback();
+    } else if (transactionContext->isAutoTransaction()) {
+        transactionContext->commit();
+    }
+}
+
 void ClientContext::addScalarFunction(std::string name, function::function_set definitions) {
     database->catalog->addFunction(std::move(name), std::move(definitions));
 }
@@ -33,8 +33,9 @@ namespace kuzu {
 namespace main {
 
 SystemConfig::SystemConfig(uint64_t bufferPoolSize_, uint64_t maxNumThreads, bool enableCompression,
-    bool readOnly, uint64_t maxDBSize)
-    : maxNumThreads{maxNumThreads}, enableCompression{enableCompression}, readOnly(readOnly) {
+    bool readOnly, uint64_t maxDBSize, uint64_t checkpointThreshold)
+    : maxNumThreads{maxNumThreads}, enableCompression{enableCompression}, readOnly(readOnly),
+      checkpointThreshold{checkpointThreshold} {
     if (bufferPoolSize_ == -1u || bufferPoolSize_ == 0) {
 #if defined(_WIN32)
         MEMORYSTATUSEX status;
@@ -62,6 +63,9 @@ SystemConfig::SystemConfig(uint64_t bufferPoolSize_, uint64_t maxNumThreads, boo
         maxDBSize = BufferPoolConstants::DEFAULT_VM_REGION_MAX_SIZE;
     }
     this->maxDBSize = maxDBSize;
+    if (checkpointThreshold == -1u) {
+        this->checkpointThreshold = DEFAULT_CHECKPOINT_THRESHOLD;
+    }
 }
 
 static void getLockFileFlagsAndType(bool readOnly, bool createNew, int& flags, FileLockType& lock) {
@@ -73,7 +77,7 @@ static void getLockFileFlagsAndType(bool readOnly, bool createNew, int& flags, F
 }
 
 Database::Database(std::string_view databasePath, SystemConfig systemConfig)
-    : systemConfig{systemConfig} {
+    : systemConfig{systemConfig}, checkpointThreadStopped{false} {
     initLoggers();
     logger = LoggerUtils::getLogger(LoggerConstants::LoggerEnum::DATABASE);
     vfs = std::make_unique<VirtualFileSystem>();
@@ -84,9 +88,15 @@ Database::Database(std::string_view databasePath, SystemConfig systemConfig)
     this->databasePath = vfs->expandPath(&clientContext, dbPathStr);
     bufferManager = std::make_unique<BufferManager>(this->systemConfig.bufferPoolSize,
         this->systemConfig.maxDBSize);
-    memoryManager = std::make_unique<MemoryManager>(bufferManager.get(), vfs.get());
     queryProcessor = std::make_unique<processor::QueryProcessor>(this->systemConfig.maxNumThreads);
     initDBDirAndCoreFilesIfNecessary();
+    // Intermediate buffers are spilled to the database directory, which is locked by now. Read-only
+    // databases may share the directory, so they keep all buffers in memory.
+    auto spillFilePath = systemConfig.readOnly ?
+                             std::string() :
+                             StorageUtils::getSpillFilePath(vfs.get(), this->databasePath);
+    memoryManager =
+        std::make_unique<MemoryManager>(bufferManager.get(), vfs.get(), std::move(spillFilePath));
     wal =
         std::make_unique<WAL>(this->databasePath, systemConfig.readOnly, *bufferManager, vfs.get());
     recoverIfNecessary();
@@ -96,9 +106,21 @@ Database::Database(std::string_view databasePath, SystemConfig systemConfig)
     transactionManager = std::make_unique<transaction::TransactionManager>(*wal);
     extensionOptions = std::make_unique<extension::ExtensionOptions>();
     databaseManager = std::make_unique<DatabaseManager>();
+    if (!systemConfig.readOnly && systemConfig.checkpointThreshold > 0) {
+        checkpointThread = std::thread([this]() { runCheckpointThread(); });
+    }
 }
 
 Database::~Database() {
+    stopCheckpointThread();
+    if (!systemConfig.readOnly) {
+        try {
+            checkpoint();
+        } catch (std::exception& e) {
+            // The committed changes are recovered from the WAL when the database is opened again.
+            logger->error("Failed to checkpoint when closing the database: {}", e.what());
+        }
+    }
     dropLoggers();
     bufferManager->clearEvictionQueue();
 }
@@ -220,14 +242,30 @@ void Database::commit(Transaction* transaction, bool skipCheckpointForTestingRec
     // Note: committing and stopping new transactions can be done in any order. This
     // order allows us to throw exceptions if we have to wait a lot to stop.
     transactionManager->commitButKeepActiveWriteTransaction(transaction);
-    wal->flushAllPages();
+    auto numCommits = wal->getNumCommitsLogged();
     if (skipCheckpointForTestingRecovery) {
         transactionManager->allowReceivingNewTransactions();
         return;
     }
-    checkpointAndClearWAL(WALReplayMode::COMMIT_CHECKPOINT);
+    auto committedInMemory = systemConfig.checkpointThreshold > 0 && wal->canCommitInMemory();
+    if (committedInMemory) {
+        commitInMemory();
+        // The background thread normally checkpoints the WAL before it gets this large, but it
+        // may keep finding a write transaction active.
+        if (wal->getFileSize() >= 2 * systemConfig.checkpointThreshold) {
+            checkpointAndClearWAL(WALReplayMode::COMMIT_CHECKPOINT);
+        }
+    } else {
+        checkpointAndClearWAL(WALReplayMode::COMMIT_CHECKPOINT);
+    }
     transactionManager->manuallyClearActiveWriteTransaction(transaction);
     transactionManager->allowReceivingNewTransactions();
+    if (committedInMemory && wal->getFileSize() >= systemConfig.checkpointThreshold) {
+        checkpointThreadCV.notify_one();
+    }
+    // The next write transaction can already start while the WAL is synced, and its commit is
+    // then synced together with the commits waiting for the sync in progress.
+    wal->syncCommits(numCommits);
 }
 
 void Database::rollback(transaction::Transaction* transaction,
@@ -247,9 +285,20 @@ void Database::rollback(transaction::Transaction* transaction,
     transactionManager->manuallyClearActiveWriteTransaction(transaction);
 }
 
+void Database::commitInMemory() {
+    auto walReplayer = std::make_unique<WALReplayer>(wal.get(), storageManager.get(),
+        bufferManager.get(), catalog.get(), WALReplayMode::COMMIT_IN_MEMORY, vfs.get());
+    walReplayer->replay();
+    wal->setRecordsCommittedInMemory();
+}
+
 void Database::checkpointAndClearWAL(WALReplayMode replayMode) {
     KU_ASSERT(replayMode == WALReplayMode::COMMIT_CHECKPOINT ||
               replayMode == WALReplayMode::RECOVERY_CHECKPOINT);
+    // Recovery never finds records committed in memory, as they are only tracked in memory.
+    if (wal->hasRecordsCommittedInMemory()) {
+        storageManager->writeBackDirtyPages();
+    }
     auto walReplayer = std::make_unique<WALReplayer>(wal.get(), storageManager.get(),
         bufferManager.get(), catalog.get(), replayMode, vfs.get());
     walReplayer->replay();
@@ -260,6 +309,11 @@ void Database::rollbackAndClearWAL() {
     auto walReplayer = std::make_unique<WALReplayer>(wal.get(), storageManager.get(),
         bufferManager.get(), catalog.get(), WALReplayMode::ROLLBACK, vfs.get());
     walReplayer->replay();
+    // Recovery would replay the records of the rolled back transaction as part of the next
+    // committed one, so the transactions committed before it are checkpointed first.
+    if (wal->hasRecordsCommittedInMemory()) {
+        storageManager->writeBackDirtyPages();
+    }
     wal->clearWAL();
 }
 
@@ -271,5 +325,61 @@ void Database::recoverIfNecessary() {
     }
 }
 
+void Database::checkpoint() {
+    if (!transactionManager->tryStartCheckpoint()) {
+        return;
+    }
+    try {
+        if (wal->hasRecordsCommittedInMemory()) {
+            // Read transactions only read the committed versions of pages, so they can keep
+            // running while the pages are written back. Clearing the WAL waits for them to leave
+            // and is retried by the next checkpoint if any is still active.
+            storageManager->writeBackDirtyPages();
+            if (transactionManager->tryStopNewTransactionsIfNoActiveReadTransactions()) {
+                try {
+                    wal->clearWAL();
+                } catch (...) {
+                    transactionManager->allowReceivingNewTransactions();
+                    throw;
+                }
+                transactionManager->allowReceivingNewTransactions();
+            }
+        }
+    } catch (...) {
+        transactionManager->finishCheckpoint();
+        throw;
+    }
+    transactionManager->finishCheckpoint();
+}
+
+void Database::runCheckpointThread() {
+    std::unique_lock lck{mtxForCheckpointThread};
+    while (!checkpointThreadStopped) {
+        checkpointThreadCV.wait_for(lck, std::chrono::microseconds(CHECKPOINT_INTERVAL_IN_MICROS));
+        if (checkpointThreadStopped) {
+            break;
+        }
+        lck.unlock();
+        try {
+            checkpoint();
+        } catch (std::exception& e) {
+            logger->error("Failed to checkpoint in the background: {}", e.what());
+        }
+        lck.lock();
+    }
+}
+
+void Database::stopCheckpointThread() {
+    if (!checkpointThread.joinable()) {
+        return;
+    }
+    {
+        std::unique_lock lck{mtxForCheckpointThread};
+        checkpointThreadStopped = true;
+    }
+    checkpointThreadCV.notify_one();
+    checkpointThread.join();
+}
+
 } // namespace main
 } // namespace kuzu
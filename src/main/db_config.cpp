@@ -16,7 +16,8 @@ static ConfigurationOption options[] = { // NOLINT(cert-err58-cpp):
     GET_CONFIGURATION(VarLengthExtendMaxDepthSetting), GET_CONFIGURATION(EnableSemiMaskSetting),
     GET_CONFIGURATION(HomeDirectorySetting), GET_CONFIGURATION(FileSearchPathSetting),
     GET_CONFIGURATION(ProgressBarSetting), GET_CONFIGURATION(ProgressBarTimerSetting),
-    GET_CONFIGURATION(EnableMultiCopySetting)};
+    GET_CONFIGURATION(EnableMultiCopySetting), GET_CONFIGURATION(QueryPrioritySetting),
+    GET_CONFIGURATION(ShortestPathWeightPropertySetting), GET_CONFIGURATION(StreamResultsSetting)};
 
 ConfigurationOption* DBConfig::getOptionByName(const std::string& optionName) {
     auto lOptionName = optionName;
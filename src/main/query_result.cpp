@@ -4,8 +4,10 @@
 #include "common/arrow/arrow_converter.h"
 #include "common/types/value/node.h"
 #include "common/types/value/rel.h"
+#include "main/client_context.h"
 #include "processor/result/factorized_table.h"
 #include "processor/result/flat_tuple.h"
+#include "processor/result/result_stream.h"
 
 using namespace kuzu::common;
 using namespace kuzu::processor;
@@ -58,7 +60,13 @@ QueryResult::QueryResult(const PreparedSummary& preparedSummary) {
     queryResultIterator = QueryResultIterator{this};
 }
 
-QueryResult::~QueryResult() = default;
+QueryResult::~QueryResult() {
+    if (resultStream != nullptr && !resultStream->isExhausted()) {
+        // Tuples that were not read are discarded.
+        std::unique_lock<std::mutex> lck{clientContext->mtx};
+        clientContext->finishResultStreamNoLock(true /* success */);
+    }
+}
 
 bool QueryResult::isSuccess() const {
     return success;
@@ -81,6 +89,9 @@ std::vector<LogicalType> QueryResult::getColumnDataTypes() const {
 }
 
 uint64_t QueryResult::getNumTuples() const {
+    if (resultStream != nullptr) {
+        return resultStream->getNumTuplesPulled();
+    }
     return factorizedTable->getTotalNumFlatTuples();
 }
 
@@ -89,6 +100,9 @@ QuerySummary* QueryResult::getQuerySummary() const {
 }
 
 void QueryResult::resetIterator() {
+    if (resultStream != nullptr) {
+        throw RuntimeException("Cannot reset the iterator of a streamed query result.");
+    }
     iterator->resetState();
 }
 
@@ -148,6 +162,45 @@ void QueryResult::initResultTableAndIterator(
     iterator = std::make_unique<FlatTupleIterator>(*factorizedTable, std::move(valuesToCollect));
 }
 
+void QueryResult::initResultStream(std::unique_ptr<ResultStream> resultStream_,
+    const binder::expression_vector& columns, ClientContext* clientContext_) {
+    resultStream = std::move(resultStream_);
+    clientContext = clientContext_;
+    initResultTableAndIterator(resultStream->getTable(), columns);
+    pullNextChunkIfNecessary();
+}
+
+void QueryResult::pullNextChunkIfNecessary() {
+    if (resultStream->isExhausted() || iterator->hasNextFlatTuple()) {
+        return;
+    }
+    try {
+        resultStream->pullNextChunk();
+    } catch (Exception& exception) {
+        // Reported by the next call to hasNext().
+        success = false;
+        errMsg = exception.what();
+        clientContext->finishResultStreamNoLock(false /* success */);
+        return;
+    }
+    iterator->resetState();
+    if (resultStream->isExhausted()) {
+        clientContext->finishResultStreamNoLock(true /* success */);
+    }
+}
+
+void QueryResult::materializeResultStream() {
+    try {
+        resultStream->pullAllTuples();
+    } catch (Exception& exception) {
+        success = false;
+        errMsg = exception.what();
+        clientContext->finishResultStreamNoLock(false /* success */);
+        return;
+    }
+    clientContext->finishResultStreamNoLock(true /* success */);
+}
+
 bool QueryResult::hasNext() const {
     validateQuerySucceed();
     return iterator->hasNextFlatTuple();
@@ -175,6 +228,11 @@ std::shared_ptr<FlatTuple> QueryResult::getNext() {
     }
     validateQuerySucceed();
     iterator->getNextFlatTuple();
+    if (resultStream != nullptr && !resultStream->isExhausted() &&
+        !iterator->hasNextFlatTuple()) {
+        std::unique_lock<std::mutex> lck{clientContext->mtx};
+        pullNextChunkIfNecessary();
+    }
     return tuple;
 }
 
@@ -189,7 +247,9 @@ std::string QueryResult::toString() {
             result += columnNames[i];
         }
         result += "\n";
-        resetIterator();
+        if (resultStream == nullptr) {
+            resetIterator();
+        }
         while (hasNext()) {
             getNext();
             result += tuple->toString();
@@ -7,6 +7,7 @@
 #include "planner/operator/logical_hash_join.h"
 #include "planner/operator/logical_intersect.h"
 #include "planner/operator/scan/logical_scan_internal_id.h"
+#include "planner/operator/scan/logical_scan_node_property.h"
 #include "planner/operator/sip/logical_semi_masker.h"
 
 using namespace kuzu::common;
@@ -30,16 +31,16 @@ void HashJoinSIPOptimizer::visitOperator(planner::LogicalOperator* op) {
 
 void HashJoinSIPOptimizer::visitHashJoin(planner::LogicalOperator* op) {
     auto hashJoin = (LogicalHashJoin*)op;
-    if (hashJoin->getSIP() == planner::SidewaysInfoPassing::PROHIBIT) {
-        return;
-    }
     if (hashJoin->getJoinType() != JoinType::INNER) {
         return;
     }
-    if (tryBuildToProbeHJSIP(op)) { // Try build to probe SIP first.
-        return;
+    if (hashJoin->getSIP() != planner::SidewaysInfoPassing::PROHIBIT) {
+        if (!tryBuildToProbeHJSIP(op)) { // Try build to probe SIP first.
+            tryProbeToBuildHJSIP(op);
+        }
     }
-    tryProbeToBuildHJSIP(op);
+    // Property keys cannot be passed as node masks, so they are passed as a bloom filter instead.
+    tryBuildToProbeBloomFilterSIP(op);
 }
 
 bool HashJoinSIPOptimizer::tryProbeToBuildHJSIP(planner::LogicalOperator* op) {
@@ -102,6 +103,69 @@ bool HashJoinSIPOptimizer::tryBuildToProbeHJSIP(planner::LogicalOperator* op) {
     return true;
 }
 
+// Returns the scan of key on the probe side whose output is probed by the hash join in the same
+// pipeline, with only operators that output tuples derived from a single input tuple in between.
+// Dropping the tuples whose key has no match at the scan is then equivalent to dropping them at the
+// probe.
+static LogicalOperator* resolveScanNodePropertyOfKey(const Expression& key,
+    LogicalOperator* probeRoot) {
+    auto op = probeRoot;
+    while (true) {
+        switch (op->getOperatorType()) {
+        case LogicalOperatorType::SCAN_NODE_PROPERTY: {
+            auto scan = ku_dynamic_cast<LogicalOperator*, LogicalScanNodeProperty*>(op);
+            if (scan->getTableIDs().size() != 1) {
+                return nullptr;
+            }
+            for (auto& property : scan->getProperties()) {
+                if (property->getUniqueName() == key.getUniqueName()) {
+                    return op;
+                }
+            }
+        } break;
+        case LogicalOperatorType::CROSS_PRODUCT:
+        case LogicalOperatorType::EXTEND:
+        case LogicalOperatorType::FILTER:
+        case LogicalOperatorType::FLATTEN:
+        case LogicalOperatorType::HASH_JOIN:
+        case LogicalOperatorType::INTERSECT:
+        case LogicalOperatorType::NODE_LABEL_FILTER:
+        case LogicalOperatorType::PROJECTION:
+        case LogicalOperatorType::SEMI_MASKER:
+            break;
+        default:
+            return nullptr;
+        }
+        if (op->getNumChildren() == 0) {
+            return nullptr;
+        }
+        // The probe side of joins is the first child.
+        op = op->getChild(0).get();
+    }
+}
+
+bool HashJoinSIPOptimizer::tryBuildToProbeBloomFilterSIP(planner::LogicalOperator* op) {
+    auto hashJoin = (LogicalHashJoin*)op;
+    if (hashJoin->getSIP() == planner::SidewaysInfoPassing::PROHIBIT_BUILD_TO_PROBE) {
+        return false;
+    }
+    auto joinConditions = hashJoin->getJoinConditions();
+    if (joinConditions.size() != 1 || !subPlanContainsFilter(hashJoin->getChild(1).get())) {
+        return false;
+    }
+    auto probeKey = joinConditions[0].first;
+    if (probeKey->expressionType != ExpressionType::PROPERTY ||
+        probeKey->dataType.getLogicalTypeID() == LogicalTypeID::INTERNAL_ID) {
+        return false;
+    }
+    auto scan = resolveScanNodePropertyOfKey(*probeKey, hashJoin->getChild(0).get());
+    if (scan == nullptr) {
+        return false;
+    }
+    hashJoin->setBloomFilterScan(scan);
+    return true;
+}
+
 void HashJoinSIPOptimizer::visitIntersect(planner::LogicalOperator* op) {
     auto intersect = (LogicalIntersect*)op;
     if (intersect->getSIP() == planner::SidewaysInfoPassing::PROHIBIT_PROBE_TO_BUILD) {
@@ -9,6 +9,7 @@
 #include "planner/operator/logical_hash_join.h"
 #include "planner/operator/scan/logical_dummy_scan.h"
 #include "planner/operator/scan/logical_index_scan.h"
+#include "planner/operator/scan/logical_scan_file.h"
 #include "planner/operator/scan/logical_scan_node_property.h"
 
 using namespace kuzu::binder;
@@ -34,6 +35,9 @@ std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::visitOperator
     case LogicalOperatorType::SCAN_NODE_PROPERTY: {
         return visitScanNodePropertyReplace(op);
     }
+    case LogicalOperatorType::SCAN_FILE: {
+        return visitScanFileReplace(op);
+    }
     default: { // Stop current push down for unhandled operator.
         for (auto i = 0u; i < op->getNumChildren(); ++i) {
             // Start new push down for child.
@@ -139,6 +143,21 @@ std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::visitScanNode
     return appendScanNodeProperty(nodeID, tableIDs, properties, currentRoot);
 }
 
+std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::visitScanFileReplace(
+    const std::shared_ptr<planner::LogicalOperator>& op) {
+    auto scanFile = ku_dynamic_cast<LogicalOperator*, LogicalScanFile*>(op.get());
+    for (auto& predicate : predicateSet->equalityPredicates) {
+        scanFile->addPredicate(predicate);
+    }
+    for (auto& predicate : predicateSet->nonEqualityPredicates) {
+        if (isExpressionComparison(predicate->expressionType) &&
+            predicate->expressionType != ExpressionType::NOT_EQUALS) {
+            scanFile->addPredicate(predicate);
+        }
+    }
+    return finishPushDown(op);
+}
+
 std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::pushDownToScanNode(
     std::shared_ptr<binder::Expression> nodeID, std::vector<common::table_id_t> tableIDs,
     std::shared_ptr<binder::Expression> predicate,
@@ -155,11 +174,33 @@ std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::pushDownToSca
                   ((PropertyExpression&)*nodeID).getVariableName());
         propertiesSet.insert(expression);
     }
-    auto scanNodeProperty = appendScanNodeProperty(std::move(nodeID), std::move(tableIDs),
+    auto scanNodeProperty = appendScanNodeProperty(nodeID, std::move(tableIDs),
         expression_vector{propertiesSet.begin(), propertiesSet.end()}, std::move(child));
+    attachPredicateToScanNode(*nodeID, predicate, scanNodeProperty.get());
     return appendFilter(std::move(predicate), scanNodeProperty);
 }
 
+void FilterPushDownOptimizer::attachPredicateToScanNode(const binder::Expression& nodeID,
+    std::shared_ptr<binder::Expression> predicate, planner::LogicalOperator* op) {
+    if (!isExpressionComparison(predicate->expressionType) ||
+        predicate->expressionType == ExpressionType::NOT_EQUALS) {
+        return;
+    }
+    // Only filters pushed down for the same node can sit between the scan and the filter of this
+    // predicate, so skipping input at the scan is equivalent to filtering it later.
+    while (op->getOperatorType() == LogicalOperatorType::FILTER) {
+        op = op->getChild(0).get();
+    }
+    if (op->getOperatorType() != LogicalOperatorType::SCAN_NODE_PROPERTY) {
+        return;
+    }
+    auto scan = ku_dynamic_cast<LogicalOperator*, LogicalScanNodeProperty*>(op);
+    if (scan->getNodeID()->getUniqueName() != nodeID.getUniqueName()) {
+        return;
+    }
+    scan->addPredicate(std::move(predicate));
+}
+
 std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::finishPushDown(
     std::shared_ptr<planner::LogicalOperator> op) {
     if (predicateSet->isEmpty()) {
@@ -19,6 +19,9 @@ void LogicalOperatorVisitor::visitOperatorSwitch(planner::LogicalOperator* op) {
     case LogicalOperatorType::SCAN_INTERNAL_ID: {
         visitScanInternalID(op);
     } break;
+    case LogicalOperatorType::SCAN_FILE: {
+        visitScanFile(op);
+    } break;
     case LogicalOperatorType::INDEX_SCAN_NODE: {
         visitIndexScanNode(op);
     } break;
@@ -111,6 +114,9 @@ std::shared_ptr<planner::LogicalOperator> LogicalOperatorVisitor::visitOperatorR
     case LogicalOperatorType::SCAN_INTERNAL_ID: {
         return visitScanInternalIDReplace(op);
     }
+    case LogicalOperatorType::SCAN_FILE: {
+        return visitScanFileReplace(op);
+    }
     case LogicalOperatorType::INDEX_SCAN_NODE: {
         return visitIndexScanNodeReplace(op);
     }
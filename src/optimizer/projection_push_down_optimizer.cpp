@@ -5,9 +5,11 @@
 #include "planner/operator/extend/logical_extend.h"
 #include "planner/operator/extend/logical_recursive_extend.h"
 #include "planner/operator/logical_accumulate.h"
+#include "planner/operator/logical_distinct.h"
 #include "planner/operator/logical_filter.h"
 #include "planner/operator/logical_hash_join.h"
 #include "planner/operator/logical_intersect.h"
+#include "planner/operator/logical_mark_accmulate.h"
 #include "planner/operator/logical_order_by.h"
 #include "planner/operator/logical_projection.h"
 #include "planner/operator/logical_unwind.h"
@@ -16,6 +18,7 @@
 #include "planner/operator/persistent/logical_insert.h"
 #include "planner/operator/persistent/logical_merge.h"
 #include "planner/operator/persistent/logical_set.h"
+#include "planner/operator/scan/logical_scan_file.h"
 
 using namespace kuzu::common;
 using namespace kuzu::planner;
@@ -61,6 +64,16 @@ void ProjectionPushDownOptimizer::visitExtend(planner::LogicalOperator* op) {
     collectExpressionsInUse(boundNodeID);
 }
 
+void ProjectionPushDownOptimizer::visitScanFile(planner::LogicalOperator* op) {
+    auto scanFile = ku_dynamic_cast<LogicalOperator*, LogicalScanFile*>(op);
+    std::vector<bool> columnSkips;
+    for (auto& column : scanFile->getInfo()->columns) {
+        columnSkips.push_back(column->expressionType == ExpressionType::VARIABLE &&
+                              !variablesInUse.contains(column));
+    }
+    scanFile->setColumnSkips(std::move(columnSkips));
+}
+
 void ProjectionPushDownOptimizer::visitAccumulate(planner::LogicalOperator* op) {
     auto accumulate = (LogicalAccumulate*)op;
     if (accumulate->getAccumulateType() != AccumulateType::REGULAR) {
@@ -74,6 +87,23 @@ void ProjectionPushDownOptimizer::visitAccumulate(planner::LogicalOperator* op)
     preAppendProjection(op, 0, expressionsAfterPruning);
 }
 
+void ProjectionPushDownOptimizer::visitMarkAccumulate(planner::LogicalOperator* op) {
+    auto markAccumulate = ku_dynamic_cast<LogicalOperator*, LogicalMarkAccumulate*>(op);
+    for (auto& key : markAccumulate->getKeys()) {
+        collectExpressionsInUse(key);
+    }
+}
+
+void ProjectionPushDownOptimizer::visitDistinct(planner::LogicalOperator* op) {
+    auto distinct = ku_dynamic_cast<LogicalOperator*, LogicalDistinct*>(op);
+    for (auto& expression : distinct->getKeys()) {
+        collectExpressionsInUse(expression);
+    }
+    for (auto& expression : distinct->getPayloads()) {
+        collectExpressionsInUse(expression);
+    }
+}
+
 void ProjectionPushDownOptimizer::visitFilter(planner::LogicalOperator* op) {
     auto filter = (LogicalFilter*)op;
     collectExpressionsInUse(filter->getPredicate());
@@ -271,6 +301,10 @@ void ProjectionPushDownOptimizer::collectExpressionsInUse(
         propertiesInUse.insert(std::move(expression));
         return;
     }
+    if (expression->expressionType == ExpressionType::VARIABLE) {
+        variablesInUse.insert(std::move(expression));
+        return;
+    }
     if (expression->expressionType == ExpressionType::PATTERN) {
         patternInUse.insert(expression);
     }
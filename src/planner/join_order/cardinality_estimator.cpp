@@ -133,7 +133,8 @@ double CardinalityEstimator::getExtensionRate(const RelExpression& rel,
     }
     case QueryRelType::VARIABLE_LENGTH:
     case QueryRelType::SHORTEST:
-    case QueryRelType::ALL_SHORTEST: {
+    case QueryRelType::ALL_SHORTEST:
+    case QueryRelType::WEIGHTED_SHORTEST: {
         return std::min<double>(oneHopExtensionRate * rel.getUpperBound(), numRels);
     }
     default:
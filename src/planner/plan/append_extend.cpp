@@ -158,13 +158,25 @@ void Planner::appendRecursiveExtend(const std::shared_ptr<NodeExpression>& bound
     // Create recursive plan
     auto recursivePlan = std::make_unique<LogicalPlan>();
     createRecursivePlan(*recursiveInfo, direction, *recursivePlan);
+    // Shortest paths to a single dst node can be searched from both ends. We don't with a node
+    // predicate, which applies to the intermediate nodes of a path but not to its src and dst.
+    std::shared_ptr<LogicalOperator> bwdRecursiveRoot;
+    auto relType = rel->getRelType();
+    if ((relType == QueryRelType::SHORTEST || relType == QueryRelType::ALL_SHORTEST) &&
+        recursiveInfo->nodePredicate == nullptr) {
+        auto bwdRecursivePlan = std::make_unique<LogicalPlan>();
+        createRecursivePlan(*recursiveInfo, ExtendDirectionUtils::getReverse(direction),
+            *bwdRecursivePlan);
+        bwdRecursiveRoot = bwdRecursivePlan->getLastOperator();
+    }
     // Create recursive extend
     if (boundNode->getNumTableIDs() > recursiveInfo->node->getNumTableIDs()) {
         appendNodeLabelFilter(boundNode->getInternalID(), recursiveInfo->node->getTableIDsSet(),
             plan);
     }
     auto extend = std::make_shared<LogicalRecursiveExtend>(boundNode, nbrNode, rel, direction,
-        RecursiveJoinType::TRACK_PATH, plan.getLastOperator(), recursivePlan->getLastOperator());
+        RecursiveJoinType::TRACK_PATH, plan.getLastOperator(), recursivePlan->getLastOperator(),
+        std::move(bwdRecursiveRoot));
     appendFlattens(extend->getGroupsPosToFlatten(), plan);
     extend->setChild(0, plan.getLastOperator());
     extend->computeFactorizedSchema();
@@ -238,6 +250,9 @@ void Planner::createRecursivePlan(const RecursiveInfo& recursiveInfo, ExtendDire
     }
     auto relProperties = collectPropertiesToRead(recursiveInfo.relPredicate);
     relProperties.push_back(rel->getInternalIDProperty());
+    if (recursiveInfo.weight != nullptr) {
+        relProperties.push_back(recursiveInfo.weight);
+    }
     auto iri = getIRIProperty(relProperties);
     if (iri != nullptr) {
         // IRI Cannot be scanned directly from rel table. For recursive plan filter, we first read
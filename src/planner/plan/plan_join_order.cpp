@@ -322,7 +322,8 @@ void Planner::appendExtendAndFilter(const std::shared_ptr<NodeExpression>& bound
     } break;
     case QueryRelType::VARIABLE_LENGTH:
     case QueryRelType::SHORTEST:
-    case QueryRelType::ALL_SHORTEST: {
+    case QueryRelType::ALL_SHORTEST:
+    case QueryRelType::WEIGHTED_SHORTEST: {
         appendRecursiveExtend(boundNode, nbrNode, rel, direction, plan);
     } break;
     default:
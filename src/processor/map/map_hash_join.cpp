@@ -1,6 +1,8 @@
 #include "planner/operator/logical_hash_join.h"
+#include "planner/operator/scan/logical_scan_node_property.h"
 #include "processor/operator/hash_join/hash_join_build.h"
 #include "processor/operator/hash_join/hash_join_probe.h"
+#include "processor/operator/scan/scan_node_table.h"
 #include "processor/plan_mapper.h"
 
 using namespace kuzu::binder;
@@ -57,6 +59,21 @@ std::unique_ptr<HashJoinBuildInfo> PlanMapper::createHashBuildInfo(const Schema&
         std::move(payloadsPos), std::move(tableSchema));
 }
 
+void PlanMapper::mapBloomFilterScan(LogicalOperator* logicalScan, const Expression& key,
+    HashJoinSharedState& sharedState) {
+    auto properties = ((LogicalScanNodeProperty*)logicalScan)->getProperties();
+    auto keyIdx = 0u;
+    while (properties[keyIdx]->getUniqueName() != key.getUniqueName()) {
+        keyIdx++;
+    }
+    auto physicalScan = logicalOpToPhysicalOpMap.at(logicalScan);
+    KU_ASSERT(physicalScan->getOperatorType() == PhysicalOperatorType::SCAN_NODE_TABLE);
+    auto bloomFilter = std::make_shared<BloomFilter>();
+    sharedState.setBloomFilter(bloomFilter);
+    ku_dynamic_cast<PhysicalOperator*, ScanSingleNodeTable*>(physicalScan)
+        ->setBloomFilter(std::move(bloomFilter), keyIdx);
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(LogicalOperator* logicalOperator) {
     auto hashJoin = (LogicalHashJoin*)logicalOperator;
     auto outSchema = hashJoin->getSchema();
@@ -86,6 +103,9 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(LogicalOperator* logic
     auto globalHashTable = std::make_unique<JoinHashTable>(*clientContext->getMemoryManager(),
         LogicalType::copy(buildKeyTypes), buildInfo->getTableSchema()->copy());
     auto sharedState = std::make_shared<HashJoinSharedState>(std::move(globalHashTable));
+    if (hashJoin->getBloomFilterScan() != nullptr) {
+        mapBloomFilterScan(hashJoin->getBloomFilterScan(), *probeKeys[0], *sharedState);
+    }
     auto hashJoinBuild =
         make_unique<HashJoinBuild>(std::make_unique<ResultSetDescriptor>(buildSchema), sharedState,
             std::move(buildInfo), std::move(buildSidePrevOperator), getOperatorID(), paramsString);
@@ -57,11 +57,28 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(
         nbrNode->getTableIDsSet(), lengthPos, std::move(recursivePlanResultSetDescriptor),
         recursiveDstNodeIDPos, recursiveInfo->node->getTableIDsSet(), recursiveEdgeIDPos, pathPos,
         std::move(tableIDToName));
+    if (recursiveInfo->weight != nullptr) {
+        dataInfo->recursiveWeightPos =
+            DataPos(recursivePlanSchema->getExpressionPos(*recursiveInfo->weight));
+    }
+    // Map recursive plan extending in the opposite direction
+    std::unique_ptr<PhysicalOperator> bwdRecursiveRoot;
+    auto logicalBwdRecursiveRoot = extend->getBwdRecursiveChild();
+    if (logicalBwdRecursiveRoot != nullptr) {
+        bwdRecursiveRoot = mapOperator(logicalBwdRecursiveRoot.get());
+        auto bwdRecursivePlanSchema = logicalBwdRecursiveRoot->getSchema();
+        dataInfo->bwdLocalResultSetDescriptor =
+            std::make_unique<ResultSetDescriptor>(bwdRecursivePlanSchema);
+        dataInfo->bwdRecursiveDstNodeIDPos = DataPos(
+            bwdRecursivePlanSchema->getExpressionPos(*recursiveInfo->nodeCopy->getInternalID()));
+        dataInfo->bwdRecursiveEdgeIDPos = DataPos(bwdRecursivePlanSchema->getExpressionPos(
+            *recursiveInfo->rel->getInternalIDProperty()));
+    }
     auto prevOperator = mapOperator(logicalOperator->getChild(0).get());
     return std::make_unique<RecursiveJoin>(rel->getLowerBound(), rel->getUpperBound(),
         rel->getRelType(), extend->getJoinType(), sharedState, std::move(dataInfo),
         std::move(prevOperator), getOperatorID(), extend->getExpressionsForPrinting(),
-        std::move(recursiveRoot));
+        std::move(recursiveRoot), std::move(bwdRecursiveRoot));
 }
 
 } // namespace processor
@@ -21,6 +21,16 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapScanFile(LogicalOperator* logic
     auto info = InQueryCallInfo();
     info.function = scanFileInfo->func;
     info.bindData = scanFileInfo->bindData->copy();
+    info.bindData->columnSkips = scanFile->getColumnSkips();
+    info.bindData->columnPredicates =
+        getColumnPredicates(scanFile->getPredicates(), [&](const binder::Expression& expression) {
+            for (auto i = 0u; i < scanFileInfo->columns.size(); ++i) {
+                if (scanFileInfo->columns[i]->getUniqueName() == expression.getUniqueName()) {
+                    return (column_id_t)i;
+                }
+            }
+            return INVALID_COLUMN_ID;
+        });
     info.outPosV = outPosV;
     if (scanFile->hasOffset()) {
         info.rowOffsetPos = getDataPos(*scanFile->getOffset(), *outSchema);
@@ -61,7 +61,17 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeProperty(
         auto info = std::make_unique<ScanNodeTableInfo>(
             ku_dynamic_cast<storage::Table*, storage::NodeTable*>(
                 clientContext->getStorageManager()->getTable(tableID)),
-            std::move(columnIDs));
+            std::move(columnIDs),
+            getColumnPredicates(scanProperty.getPredicates(), [&](const Expression& expression) {
+                if (expression.expressionType != ExpressionType::PROPERTY) {
+                    return INVALID_COLUMN_ID;
+                }
+                auto& property = ku_dynamic_cast<const Expression&, const PropertyExpression&>(
+                    expression);
+                return property.hasPropertyID(tableID) ?
+                           tableSchema->getColumnID(property.getPropertyID(tableID)) :
+                           INVALID_COLUMN_ID;
+            }));
         return std::make_unique<ScanSingleNodeTable>(std::move(info), inputNodeIDVectorPos,
             std::move(outVectorsPos), std::move(prevOperator), getOperatorID(),
             scanProperty.getExpressionsForPrinting());
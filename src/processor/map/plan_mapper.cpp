@@ -1,7 +1,10 @@
 #include "processor/plan_mapper.h"
 
+#include "binder/expression/literal_expression.h"
+#include "common/type_utils.h"
 #include "processor/operator/profile.h"
 
+using namespace kuzu::binder;
 using namespace kuzu::common;
 using namespace kuzu::planner;
 
@@ -190,6 +193,56 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapOperator(LogicalOperator* logic
     return physicalOperator;
 }
 
+static ExpressionType flipComparison(ExpressionType comparisonType) {
+    switch (comparisonType) {
+    case ExpressionType::GREATER_THAN:
+        return ExpressionType::LESS_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return ExpressionType::LESS_THAN_EQUALS;
+    case ExpressionType::LESS_THAN:
+        return ExpressionType::GREATER_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return ExpressionType::GREATER_THAN_EQUALS;
+    default:
+        return comparisonType;
+    }
+}
+
+std::vector<storage::ColumnPredicate> PlanMapper::getColumnPredicates(
+    const expression_vector& predicates,
+    const std::function<column_id_t(const Expression&)>& getColumnID) {
+    std::vector<storage::ColumnPredicate> columnPredicates;
+    for (auto& predicate : predicates) {
+        auto comparisonType = predicate->expressionType;
+        auto column = predicate->getChild(0);
+        auto literal = predicate->getChild(1);
+        if (column->expressionType == ExpressionType::LITERAL) {
+            std::swap(column, literal);
+            comparisonType = flipComparison(comparisonType);
+        }
+        if (literal->expressionType != ExpressionType::LITERAL ||
+            column->dataType != literal->dataType) {
+            continue;
+        }
+        auto columnID = getColumnID(*column);
+        auto value = ku_dynamic_cast<Expression*, LiteralExpression*>(literal.get())->getValue();
+        auto physicalType = column->dataType.getPhysicalType();
+        if (columnID == INVALID_COLUMN_ID || value->isNull() ||
+            !storage::ColumnChunkStats::isSupported(physicalType)) {
+            continue;
+        }
+        storage::StorageValue storageValue;
+        TypeUtils::visit(
+            physicalType,
+            [&]<typename T>(T)
+                requires(std::is_integral_v<T> || std::is_floating_point_v<T>)
+            { storageValue = storage::StorageValue::fromValue(*(T*)&value->val); },
+            [](auto) { KU_UNREACHABLE; });
+        columnPredicates.emplace_back(columnID, comparisonType, storageValue);
+    }
+    return columnPredicates;
+}
+
 std::vector<DataPos> PlanMapper::getExpressionsDataPos(const binder::expression_vector& expressions,
     const planner::Schema& schema) {
     std::vector<DataPos> result;
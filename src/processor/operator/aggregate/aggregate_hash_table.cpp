@@ -202,6 +202,24 @@ void AggregateHashTable::resize(uint64_t newSize) {
     }
 }
 
+void AggregateHashTable::pinBuffers() {
+    BaseHashTable::pinBuffers();
+    for (auto& distinctHT : distinctHashTables) {
+        if (distinctHT != nullptr) {
+            distinctHT->pinBuffers();
+        }
+    }
+}
+
+void AggregateHashTable::unpinBuffers() {
+    BaseHashTable::unpinBuffers();
+    for (auto& distinctHT : distinctHashTables) {
+        if (distinctHT != nullptr) {
+            distinctHT->unpinBuffers();
+        }
+    }
+}
+
 uint64_t AggregateHashTable::matchFTEntries(const std::vector<ValueVector*>& flatKeyVectors,
     const std::vector<ValueVector*>& unFlatKeyVectors, uint64_t numMayMatches,
     uint64_t numNoMatches) {
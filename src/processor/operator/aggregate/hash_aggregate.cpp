@@ -12,12 +12,15 @@ namespace processor {
 
 void HashAggregateSharedState::appendAggregateHashTable(
     std::unique_ptr<AggregateHashTable> aggregateHashTable) {
+    // The table is not accessed until all threads finish, so it can be spilled in the meantime.
+    aggregateHashTable->unpinBuffers();
     std::unique_lock lck{mtx};
     localAggregateHashTables.push_back(std::move(aggregateHashTable));
 }
 
 void HashAggregateSharedState::combineAggregateHashTable(MemoryManager& /*memoryManager*/) {
     std::unique_lock lck{mtx};
+    localAggregateHashTables[0]->pinBuffers();
     if (localAggregateHashTables.size() == 1) {
         globalAggregateHashTable = std::move(localAggregateHashTables[0]);
     } else {
@@ -27,8 +30,11 @@ void HashAggregateSharedState::combineAggregateHashTable(MemoryManager& /*memory
         }
         localAggregateHashTables[0]->resize(nextPowerOfTwo(numEntries));
         globalAggregateHashTable = std::move(localAggregateHashTables[0]);
+        // Local tables are read back one at a time, and released once merged.
         for (auto i = 1u; i < localAggregateHashTables.size(); i++) {
+            localAggregateHashTables[i]->pinBuffers();
             globalAggregateHashTable->merge(*localAggregateHashTables[i]);
+            localAggregateHashTables[i].reset();
         }
     }
 }
@@ -43,6 +43,10 @@ void HashJoinBuild::finalize(ExecutionContext* /*context*/) {
     auto numTuples = sharedState->getHashTable()->getNumTuples();
     sharedState->getHashTable()->allocateHashSlots(numTuples);
     sharedState->getHashTable()->buildHashSlots();
+    if (sharedState->getBloomFilter() != nullptr) {
+        sharedState->getBloomFilter()->init(numTuples);
+        sharedState->getHashTable()->insertHashes(*sharedState->getBloomFilter());
+    }
 }
 
 void HashJoinBuild::executeInternal(ExecutionContext* context) {
@@ -112,13 +112,26 @@ void JoinHashTable::allocateHashSlots(uint64_t numTuples) {
 }
 
 void JoinHashTable::buildHashSlots() {
+    auto numBytesPerTuple = factorizedTable->getTableSchema()->getNumBytesPerTuple();
     for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
         uint8_t* tuple = tupleBlock->getData();
         for (auto i = 0u; i < tupleBlock->numTuples; i++) {
             auto lastSlotEntryInHT = insertEntry(tuple);
             auto prevPtr = getPrevTuple(tuple);
             memcpy(prevPtr, &lastSlotEntryInHT, sizeof(uint8_t*));
-            tuple += factorizedTable->getTableSchema()->getNumBytesPerTuple();
+            tuple += numBytesPerTuple;
+        }
+    }
+}
+
+void JoinHashTable::insertHashes(BloomFilter& bloomFilter) const {
+    auto numBytesPerTuple = factorizedTable->getTableSchema()->getNumBytesPerTuple();
+    auto hashColOffset = getHashValueColOffset();
+    for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
+        uint8_t* tuple = tupleBlock->getData();
+        for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+            bloomFilter.insert(*(hash_t*)(tuple + hashColOffset));
+            tuple += numBytesPerTuple;
         }
     }
 }
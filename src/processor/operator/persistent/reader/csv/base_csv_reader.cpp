@@ -16,8 +16,9 @@ namespace kuzu {
 namespace processor {
 
 BaseCSVReader::BaseCSVReader(const std::string& filePath, common::CSVOption option,
-    uint64_t numColumns, main::ClientContext* context)
-    : option{std::move(option)}, numColumns(numColumns), buffer(nullptr), bufferSize(0),
+    uint64_t numColumns, std::vector<bool> columnSkips, main::ClientContext* context)
+    : option{std::move(option)}, numColumns(numColumns), columnSkips{std::move(columnSkips)},
+      buffer(nullptr), bufferSize(0),
       position(0), osFileOffset(0), rowEmpty(false) {
     fileInfo = context->getVFSUnsafe()->openFile(filePath,
         O_RDONLY
@@ -35,6 +35,10 @@ void ParsingDriver::addValue(uint64_t rowNum, common::column_id_t columnIdx,
             stringFormat("Error in file {}, on line {}: expected {} values per row, but got more.",
                 reader->fileInfo->path, reader->getLineNumber(), reader->numColumns));
     }
+    if (columnIdx < reader->columnSkips.size() && reader->columnSkips[columnIdx]) {
+        chunk.getValueVector(columnIdx)->setNull(rowNum, true /* isNull */);
+        return;
+    }
     try {
         function::CastString::copyStringToVector(chunk.getValueVector(columnIdx).get(), rowNum,
             value, &reader->option);
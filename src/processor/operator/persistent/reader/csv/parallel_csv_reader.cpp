@@ -20,8 +20,8 @@ namespace kuzu {
 namespace processor {
 
 ParallelCSVReader::ParallelCSVReader(const std::string& filePath, CSVOption option,
-    uint64_t numColumns, main::ClientContext* context)
-    : BaseCSVReader{filePath, std::move(option), numColumns, context} {}
+    uint64_t numColumns, std::vector<bool> columnSkips, main::ClientContext* context)
+    : BaseCSVReader{filePath, std::move(option), numColumns, std::move(columnSkips), context} {}
 
 bool ParallelCSVReader::hasMoreToRead() const {
     // If we haven't started the first block yet or are done our block, get the next block.
@@ -139,7 +139,8 @@ static offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
             parallelCSVLocalState->reader = std::make_unique<ParallelCSVReader>(
                 parallelCSVSharedState->readerConfig.filePaths[fileIdx],
                 parallelCSVSharedState->csvReaderConfig.option.copy(),
-                parallelCSVSharedState->numColumns, parallelCSVSharedState->context);
+                parallelCSVSharedState->numColumns, parallelCSVSharedState->columnSkips,
+                parallelCSVSharedState->context);
         }
         auto numRowsRead = parallelCSVLocalState->reader->parseBlock(blockIdx, outputChunk);
         outputChunk.state->selVector->selectedSize = numRowsRead;
@@ -172,11 +173,12 @@ static std::unique_ptr<TableFuncSharedState> initSharedState(TableFunctionInitIn
     auto csvConfig = CSVReaderConfig::construct(bindData->config.options);
     row_idx_t numRows = 0;
     auto sharedState = std::make_unique<ParallelCSVScanSharedState>(bindData->config.copy(),
-        numRows, bindData->columnNames.size(), bindData->context, csvConfig.copy());
+        numRows, bindData->columnNames.size(), bindData->columnSkips, bindData->context,
+        csvConfig.copy());
     for (auto filePath : sharedState->readerConfig.filePaths) {
         auto reader = std::make_unique<ParallelCSVReader>(filePath,
             sharedState->csvReaderConfig.option.copy(), sharedState->numColumns,
-            sharedState->context);
+            std::vector<bool>{}, sharedState->context);
         sharedState->totalSize += reader->getFileSize();
     }
     return sharedState;
@@ -187,7 +189,8 @@ static std::unique_ptr<TableFuncLocalState> initLocalState(TableFunctionInitInpu
     auto localState = std::make_unique<ParallelCSVLocalState>();
     auto sharedState = ku_dynamic_cast<TableFuncSharedState*, ParallelCSVScanSharedState*>(state);
     localState->reader = std::make_unique<ParallelCSVReader>(sharedState->readerConfig.filePaths[0],
-        sharedState->csvReaderConfig.option.copy(), sharedState->numColumns, sharedState->context);
+        sharedState->csvReaderConfig.option.copy(), sharedState->numColumns,
+        sharedState->columnSkips, sharedState->context);
     localState->fileIdx = 0;
     return localState;
 }
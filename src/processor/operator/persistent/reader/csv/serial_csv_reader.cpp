@@ -12,8 +12,8 @@ namespace kuzu {
 namespace processor {
 
 SerialCSVReader::SerialCSVReader(const std::string& filePath, CSVOption option, uint64_t numColumns,
-    main::ClientContext* context)
-    : BaseCSVReader{filePath, std::move(option), numColumns, context} {}
+    std::vector<bool> columnSkips, main::ClientContext* context)
+    : BaseCSVReader{filePath, std::move(option), numColumns, std::move(columnSkips), context} {}
 
 std::vector<std::pair<std::string, LogicalType>> SerialCSVReader::sniffCSV() {
     readBOM();
@@ -64,7 +64,7 @@ void SerialCSVScanSharedState::read(DataChunk& outputChunk) {
 void SerialCSVScanSharedState::initReader(main::ClientContext* context) {
     if (fileIdx < readerConfig.getNumFiles()) {
         reader = std::make_unique<SerialCSVReader>(readerConfig.filePaths[fileIdx],
-            csvReaderConfig.option.copy(), numColumns, context);
+            csvReaderConfig.option.copy(), numColumns, columnSkips, context);
     }
 }
 
@@ -79,7 +79,7 @@ static void bindColumnsFromFile(const ScanTableFuncBindInput* bindInput, uint32_
     std::vector<std::string>& columnNames, std::vector<LogicalType>& columnTypes) {
     auto csvConfig = CSVReaderConfig::construct(bindInput->config.options);
     auto csvReader = SerialCSVReader(bindInput->config.filePaths[fileIdx], csvConfig.option.copy(),
-        0 /* numColumns */, bindInput->context);
+        0 /* numColumns */, std::vector<bool>{}, bindInput->context);
     auto sniffedColumns = csvReader.sniffCSV();
     for (auto& [name, type] : sniffedColumns) {
         columnNames.push_back(name);
@@ -118,11 +118,11 @@ static std::unique_ptr<TableFuncSharedState> initSharedState(TableFunctionInitIn
     auto csvConfig = CSVReaderConfig::construct(bindData->config.options);
     row_idx_t numRows = 0;
     auto sharedState = std::make_unique<SerialCSVScanSharedState>(bindData->config.copy(), numRows,
-        bindData->columnNames.size(), csvConfig.copy(), bindData->context);
+        bindData->columnNames.size(), bindData->columnSkips, csvConfig.copy(), bindData->context);
     for (auto filePath : sharedState->readerConfig.filePaths) {
         auto reader =
             std::make_unique<SerialCSVReader>(filePath, sharedState->csvReaderConfig.option.copy(),
-                sharedState->numColumns, sharedState->context);
+                sharedState->numColumns, std::vector<bool>{}, sharedState->context);
         sharedState->totalSize += reader->getFileSize();
     }
     return sharedState;
@@ -2,9 +2,12 @@
 
 #include <fcntl.h>
 
+#include <cmath>
+
 #include "common/exception/copy.h"
 #include "common/file_system/virtual_file_system.h"
 #include "common/string_format.h"
+#include "common/type_utils.h"
 #include "function/table/bind_data.h"
 #include "processor/operator/persistent/reader/parquet/list_column_reader.h"
 #include "processor/operator/persistent/reader/parquet/struct_column_reader.h"
@@ -19,8 +22,9 @@ namespace processor {
 using namespace kuzu::function;
 using namespace kuzu::common;
 
-ParquetReader::ParquetReader(const std::string& filePath, main::ClientContext* context)
-    : filePath{filePath}, context{context} {
+ParquetReader::ParquetReader(const std::string& filePath, std::vector<bool> columnSkips,
+    main::ClientContext* context)
+    : filePath{filePath}, columnSkips{std::move(columnSkips)}, context{context} {
     initMetadata();
 }
 
@@ -31,8 +35,16 @@ void ParquetReader::initializeScan(ParquetReaderScanState& state,
     state.groupOffset = 0;
     state.groupIdxList = std::move(groups_to_read);
     if (!state.fileInfo || state.fileInfo->path != filePath) {
-        state.prefetchMode = false;
         state.fileInfo = vfs->openFile(filePath, O_RDONLY, context);
+        state.prefetchMode = state.fileInfo->fileSystem->isRemote();
+        state.nextGroupPrefetch.reset();
+        state.currentGroupPrefetch.reset();
+        state.prefetchFileInfo.reset();
+    }
+    state.currentGroupPrefetch.reset();
+    if (state.nextGroupPrefetch != nullptr && !state.groupIdxList.empty() &&
+        state.nextGroupPrefetch->groupIdx == state.groupIdxList[0]) {
+        state.currentGroupPrefetch = std::move(state.nextGroupPrefetch);
     }
 
     state.thriftFileProto = createThriftProtocol(state.fileInfo.get(), state.prefetchMode);
@@ -62,8 +74,20 @@ bool ParquetReader::scanInternal(ParquetReaderScanState& state, DataChunk& resul
             return false;
         }
 
+        if (state.currentGroupPrefetch != nullptr &&
+            state.currentGroupPrefetch->groupIdx == state.groupIdxList[state.currentGroup]) {
+            // Rethrows any error of the background read.
+            state.currentGroupPrefetch->fetched.get();
+            trans.AddPrefetched(*state.currentGroupPrefetch->buffer);
+            state.currentGroupPrefetch.reset();
+            state.currentGroupPrefetched = true;
+        }
+
         uint64_t toScanCompressedBytes = 0;
         for (auto colIdx = 0u; colIdx < result.getNumValueVectors(); colIdx++) {
+            if (isColumnSkipped(colIdx)) {
+                continue;
+            }
             prepareRowGroupBuffer(state, colIdx);
 
             auto fileColIdx = colIdx;
@@ -75,7 +99,8 @@ bool ParquetReader::scanInternal(ParquetReaderScanState& state, DataChunk& resul
         }
 
         auto& group = getGroup(state);
-        if (state.prefetchMode && state.groupOffset != (uint64_t)group.num_rows) {
+        if (state.prefetchMode && !state.currentGroupPrefetched &&
+            state.groupOffset != (uint64_t)group.num_rows) {
 
             uint64_t totalRowGroupSpan = getGroupSpan(state);
 
@@ -90,16 +115,17 @@ bool ParquetReader::scanInternal(ParquetReaderScanState& state, DataChunk& resul
 
             if (scanPercentage > ParquetReaderPrefetchConfig::WHOLE_GROUP_PREFETCH_MINIMUM_SCAN) {
                 // Prefetch the whole row group
-                if (!state.currentGroupPrefetched) {
-                    auto totalCompressedSize = getGroupCompressedSize(state);
-                    if (totalCompressedSize > 0) {
-                        trans.Prefetch(getGroupOffset(state), totalRowGroupSpan);
-                    }
-                    state.currentGroupPrefetched = true;
+                auto totalCompressedSize = getGroupCompressedSize(state);
+                if (totalCompressedSize > 0) {
+                    trans.Prefetch(getGroupOffset(state), totalRowGroupSpan);
                 }
+                state.currentGroupPrefetched = true;
             } else {
                 // Prefetch column-wise.
                 for (auto colIdx = 0u; colIdx < result.getNumValueVectors(); colIdx++) {
+                    if (isColumnSkipped(colIdx)) {
+                        continue;
+                    }
                     auto fileColIdx = colIdx;
                     auto rootReader =
                         ku_dynamic_cast<ColumnReader*, StructColumnReader*>(state.rootReader.get());
@@ -144,6 +170,10 @@ bool ParquetReader::scanInternal(ParquetReaderScanState& state, DataChunk& resul
     for (auto colIdx = 0u; colIdx < result.getNumValueVectors(); colIdx++) {
         auto fileColIdx = colIdx;
         auto resultVector = result.getValueVector(colIdx);
+        if (isColumnSkipped(colIdx)) {
+            resultVector->setAllNull();
+            continue;
+        }
         auto childReader = rootReader->getChildReader(fileColIdx);
         auto rowsRead = childReader->read(resultVector->state->selVector->selectedSize, filterMask,
             definePtr, repeatPtr, resultVector.get());
@@ -212,6 +242,145 @@ void ParquetReader::initMetadata() {
 
     metadata = std::make_unique<FileMetaData>();
     metadata->read(proto.get());
+    initColumnLeaves();
+}
+
+// Advances schemaIdx past the subtree rooted at it and returns the number of leaves in the subtree.
+static uint64_t skipSchemaSubtree(const std::vector<SchemaElement>& schema, uint64_t& schemaIdx) {
+    auto& sEle = schema[schemaIdx++];
+    if (!sEle.__isset.num_children || sEle.num_children == 0) {
+        return 1;
+    }
+    uint64_t numLeaves = 0;
+    for (auto i = 0; i < sEle.num_children && schemaIdx < schema.size(); i++) {
+        numLeaves += skipSchemaSubtree(schema, schemaIdx);
+    }
+    return numLeaves;
+}
+
+void ParquetReader::initColumnLeaves() {
+    if (metadata->schema.empty()) {
+        return;
+    }
+    uint64_t schemaIdx = 1;
+    uint64_t fileIdx = 0;
+    for (auto i = 0; i < metadata->schema[0].num_children && schemaIdx < metadata->schema.size();
+         i++) {
+        auto& sEle = metadata->schema[schemaIdx];
+        auto isLeaf = !sEle.__isset.num_children || sEle.num_children == 0;
+        auto isRepeated = sEle.__isset.repetition_type &&
+                          sEle.repetition_type == FieldRepetitionType::REPEATED;
+        auto columnSchemaIdx = schemaIdx;
+        auto numFileColumns = skipSchemaSubtree(metadata->schema, schemaIdx);
+        columnLeaves.push_back(
+            ColumnLeaves{columnSchemaIdx, fileIdx, numFileColumns, isLeaf && !isRepeated});
+        fileIdx += numFileColumns;
+    }
+}
+
+// Returns the physical type whose values have the same plain encoding and ordering as the min/max
+// statistics of the column, or ANY if the statistics can't be compared against predicates.
+static PhysicalTypeID getStatsPhysicalType(const SchemaElement& sEle) {
+    if (!sEle.__isset.converted_type) {
+        switch (sEle.type) {
+        case Type::INT32:
+            return PhysicalTypeID::INT32;
+        case Type::INT64:
+            return PhysicalTypeID::INT64;
+        case Type::FLOAT:
+            return PhysicalTypeID::FLOAT;
+        case Type::DOUBLE:
+            return PhysicalTypeID::DOUBLE;
+        default:
+            return PhysicalTypeID::ANY;
+        }
+    }
+    switch (sEle.converted_type) {
+    case ConvertedType::INT_8:
+    case ConvertedType::INT_16:
+    case ConvertedType::INT_32:
+    case ConvertedType::DATE:
+        return sEle.type == Type::INT32 ? PhysicalTypeID::INT32 : PhysicalTypeID::ANY;
+    case ConvertedType::INT_64:
+        return sEle.type == Type::INT64 ? PhysicalTypeID::INT64 : PhysicalTypeID::ANY;
+    case ConvertedType::UINT_8:
+    case ConvertedType::UINT_16:
+    case ConvertedType::UINT_32:
+        return sEle.type == Type::INT32 ? PhysicalTypeID::UINT32 : PhysicalTypeID::ANY;
+    case ConvertedType::UINT_64:
+        return sEle.type == Type::INT64 ? PhysicalTypeID::UINT64 : PhysicalTypeID::ANY;
+    default:
+        return PhysicalTypeID::ANY;
+    }
+}
+
+static storage::ColumnChunkStats getColumnChunkStats(const Statistics& statistics,
+    PhysicalTypeID physicalType) {
+    storage::ColumnChunkStats stats;
+    const std::string* min = nullptr;
+    const std::string* max = nullptr;
+    if (statistics.__isset.min_value && statistics.__isset.max_value) {
+        min = &statistics.min_value;
+        max = &statistics.max_value;
+    } else if (statistics.__isset.min && statistics.__isset.max &&
+               physicalType != PhysicalTypeID::UINT32 && physicalType != PhysicalTypeID::UINT64) {
+        // The deprecated min/max fields are ordered as signed values.
+        min = &statistics.min;
+        max = &statistics.max;
+    } else {
+        return stats;
+    }
+    TypeUtils::visit(
+        physicalType,
+        [&]<typename T>(T)
+            requires(std::is_integral_v<T> || std::is_floating_point_v<T>)
+        {
+            if (min->size() != sizeof(T) || max->size() != sizeof(T)) {
+                return;
+            }
+            T minValue, maxValue;
+            memcpy(&minValue, min->data(), sizeof(T));
+            memcpy(&maxValue, max->data(), sizeof(T));
+            if constexpr (std::is_floating_point_v<T>) {
+                if (std::isnan(minValue) || std::isnan(maxValue)) {
+                    return;
+                }
+            }
+            stats.min = storage::StorageValue::fromValue(minValue);
+            stats.max = storage::StorageValue::fromValue(maxValue);
+            stats.hasStats = true;
+        },
+        [](auto) {});
+    return stats;
+}
+
+bool ParquetReader::canSkipRowGroup(uint64_t groupIdx,
+    const std::vector<storage::ColumnPredicate>& predicates) const {
+    auto& group = metadata->row_groups[groupIdx];
+    for (auto& predicate : predicates) {
+        if (predicate.columnID >= columnLeaves.size()) {
+            continue;
+        }
+        auto& leaves = columnLeaves[predicate.columnID];
+        if (!leaves.isPrimitive || leaves.startFileIdx >= group.columns.size()) {
+            continue;
+        }
+        auto& columnChunk = group.columns[leaves.startFileIdx];
+        if (!columnChunk.__isset.meta_data || !columnChunk.meta_data.__isset.statistics) {
+            continue;
+        }
+        auto& statistics = columnChunk.meta_data.statistics;
+        // Comparisons with null are never true, so no row of an all-null chunk can match.
+        if (statistics.__isset.null_count && statistics.null_count == group.num_rows) {
+            return true;
+        }
+        auto physicalType = getStatsPhysicalType(metadata->schema[leaves.schemaIdx]);
+        if (storage::ColumnChunkStats::isSupported(physicalType) &&
+            predicate.canSkip(getColumnChunkStats(statistics, physicalType), physicalType)) {
+            return true;
+        }
+    }
+    return false;
 }
 
 std::unique_ptr<ColumnReader> ParquetReader::createReaderRecursive(uint64_t depth,
@@ -563,42 +732,117 @@ uint64_t ParquetReader::getGroupOffset(ParquetReaderScanState& state) {
     return minOffset;
 }
 
+static uint64_t getColumnChunkOffset(const ColumnMetaData& metaData) {
+    auto offset = metaData.data_page_offset;
+    if (metaData.__isset.dictionary_page_offset) {
+        offset = std::min<uint64_t>(offset, metaData.dictionary_page_offset);
+    }
+    if (metaData.__isset.index_page_offset) {
+        offset = std::min<uint64_t>(offset, metaData.index_page_offset);
+    }
+    return offset;
+}
+
+void ParquetReader::prefetchGroupAsync(ParquetReaderScanState& state, uint64_t groupIdx,
+    VirtualFileSystem* vfs) {
+    KU_ASSERT(state.nextGroupPrefetch == nullptr);
+    if (!state.prefetchFileInfo) {
+        state.prefetchFileInfo = vfs->openFile(filePath, O_RDONLY, context);
+    }
+    auto buffer = std::make_unique<ReadAheadBuffer>(state.prefetchFileInfo.get());
+    auto& group = metadata->row_groups[groupIdx];
+    for (auto colIdx = 0u; colIdx < columnLeaves.size(); colIdx++) {
+        if (isColumnSkipped(colIdx)) {
+            continue;
+        }
+        auto& leaves = columnLeaves[colIdx];
+        for (auto i = 0u; i < leaves.numFileColumns; i++) {
+            auto& metaData = group.columns[leaves.startFileIdx + i].meta_data;
+            if (metaData.total_compressed_size > 0) {
+                buffer->AddReadHead(getColumnChunkOffset(metaData), metaData.total_compressed_size);
+            }
+        }
+    }
+    buffer->merge_set.clear();
+    auto fetched =
+        std::async(std::launch::async, [buffer = buffer.get()]() { buffer->Prefetch(); });
+    state.nextGroupPrefetch = std::make_unique<ParquetGroupPrefetch>(
+        ParquetGroupPrefetch{groupIdx, std::move(buffer), std::move(fetched)});
+}
+
 ParquetScanSharedState::ParquetScanSharedState(common::ReaderConfig readerConfig, uint64_t numRows,
+    std::vector<bool> columnSkips, std::vector<storage::ColumnPredicate> predicates,
     main::ClientContext* context)
-    : ScanFileSharedState{std::move(readerConfig), numRows, context} {
-    readers.push_back(
-        std::make_unique<ParquetReader>(this->readerConfig.filePaths[fileIdx], context));
+    : ScanFileSharedState{std::move(readerConfig), numRows, context},
+      columnSkips{std::move(columnSkips)}, predicates{std::move(predicates)} {
+    readers.push_back(std::make_unique<ParquetReader>(this->readerConfig.filePaths[fileIdx],
+        this->columnSkips, context));
     totalRowsGroups = 0;
     for (auto i = fileIdx; i < this->readerConfig.getNumFiles(); i++) {
-        auto reader = std::make_unique<ParquetReader>(this->readerConfig.filePaths[i], context);
+        auto reader = std::make_unique<ParquetReader>(this->readerConfig.filePaths[i],
+            std::vector<bool>{}, context);
         totalRowsGroups += reader->getNumRowsGroups();
     }
     numBlocksReadByFiles = 0;
 }
 
+static void skipPrunedGroups(ParquetScanSharedState& sharedState, ParquetReader* reader) {
+    while (sharedState.blockIdx < reader->getNumRowsGroups() &&
+           reader->canSkipRowGroup(sharedState.blockIdx, sharedState.predicates)) {
+        sharedState.blockIdx++;
+    }
+}
+
+// In prefetch mode, claims the next row group of the file being scanned for this local state and
+// starts reading it in the background, so that its I/O overlaps with decoding the current group.
+static void prefetchNextGroup(ParquetScanLocalState& localState,
+    ParquetScanSharedState& sharedState) {
+    if (!localState.state->prefetchMode || sharedState.fileIdx >= sharedState.readers.size() ||
+        sharedState.readers[sharedState.fileIdx].get() != localState.reader) {
+        return;
+    }
+    skipPrunedGroups(sharedState, localState.reader);
+    if (sharedState.blockIdx < localState.reader->getNumRowsGroups()) {
+        localState.reader->prefetchGroupAsync(*localState.state, sharedState.blockIdx,
+            sharedState.context->getVFSUnsafe());
+        sharedState.blockIdx++;
+    }
+}
+
 static bool parquetSharedStateNext(ParquetScanLocalState& localState,
     ParquetScanSharedState& sharedState) {
     std::lock_guard<std::mutex> mtx{sharedState.lock};
+    if (localState.state->nextGroupPrefetch != nullptr) {
+        // The row group claimed by the previous call has already been handed out to this state.
+        localState.reader->initializeScan(*localState.state,
+            {localState.state->nextGroupPrefetch->groupIdx},
+            sharedState.context->getVFSUnsafe());
+        prefetchNextGroup(localState, sharedState);
+        return true;
+    }
     while (true) {
         if (sharedState.fileIdx >= sharedState.readerConfig.getNumFiles()) {
             return false;
         }
-        if (sharedState.blockIdx < sharedState.readers[sharedState.fileIdx]->getNumRowsGroups()) {
-            localState.reader = sharedState.readers[sharedState.fileIdx].get();
+        auto reader = sharedState.readers[sharedState.fileIdx].get();
+        skipPrunedGroups(sharedState, reader);
+        if (sharedState.blockIdx < reader->getNumRowsGroups()) {
+            localState.reader = reader;
             localState.reader->initializeScan(*localState.state, {sharedState.blockIdx},
                 sharedState.context->getVFSUnsafe());
             sharedState.blockIdx++;
+            prefetchNextGroup(localState, sharedState);
             return true;
         } else {
-            sharedState.numBlocksReadByFiles +=
-                sharedState.readers[sharedState.fileIdx]->getNumRowsGroups();
+            sharedState.numBlocksReadByFiles += reader->getNumRowsGroups();
             sharedState.blockIdx = 0;
             sharedState.fileIdx++;
             if (sharedState.fileIdx >= sharedState.readerConfig.getNumFiles()) {
                 return false;
             }
             sharedState.readers.push_back(std::make_unique<ParquetReader>(
-                sharedState.readerConfig.filePaths[sharedState.fileIdx], sharedState.context));
+                sharedState.readerConfig.filePaths[sharedState.fileIdx], sharedState.columnSkips,
+                sharedState.context));
             continue;
         }
     }
@@ -626,7 +870,8 @@ static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output
 
 static void bindColumns(const ScanTableFuncBindInput* bindInput, uint32_t fileIdx,
     std::vector<std::string>& columnNames, std::vector<common::LogicalType>& columnTypes) {
-    auto reader = ParquetReader(bindInput->config.filePaths[fileIdx], bindInput->context);
+    auto reader = ParquetReader(bindInput->config.filePaths[fileIdx], std::vector<bool>{},
+        bindInput->context);
     auto state = std::make_unique<processor::ParquetReaderScanState>();
     reader.initializeScan(*state, std::vector<uint64_t>{}, bindInput->context->getVFSUnsafe());
     for (auto i = 0u; i < reader.getNumColumns(); ++i) {
@@ -672,10 +917,12 @@ static std::unique_ptr<function::TableFuncSharedState> initSharedState(
     auto parquetScanBindData = ku_dynamic_cast<TableFuncBindData*, ScanBindData*>(input.bindData);
     row_idx_t numRows = 0;
     for (const auto& path : parquetScanBindData->config.filePaths) {
-        auto reader = std::make_unique<ParquetReader>(path, parquetScanBindData->context);
+        auto reader =
+            std::make_unique<ParquetReader>(path, std::vector<bool>{}, parquetScanBindData->context);
         numRows += reader->getMetadata()->num_rows;
     }
     return std::make_unique<ParquetScanSharedState>(parquetScanBindData->config.copy(), numRows,
+        parquetScanBindData->columnSkips, parquetScanBindData->columnPredicates,
         parquetScanBindData->context);
 }
 
@@ -0,0 +1,141 @@
+#include "processor/operator/recursive_extend/bidirectional_bfs_state.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+void BidirectionalBFSState::Side::reset(nodeID_t startNodeID) {
+    frontiers.clear();
+    visited.clear();
+    frontiers.push_back(std::make_unique<Frontier>());
+    frontiers[0]->addNodeWithMultiplicity(startNodeID, 1 /* multiplicity */);
+    visited.insert(startNodeID);
+}
+
+void BidirectionalBFSState::resetState() {
+    currentLevel = 0;
+    nextNodeIdxToExtend = 0;
+    frontiers.clear();
+    meetingNodeIDs.clear();
+}
+
+bool BidirectionalBFSState::isComplete() {
+    return !meetingNodeIDs.empty() || srcSide.getLastFrontier()->nodeIDs.empty() ||
+           dstSide.getLastFrontier()->nodeIDs.empty() || isUpperBoundReached();
+}
+
+void BidirectionalBFSState::markSrc(nodeID_t nodeID) {
+    srcNodeID = nodeID;
+    srcSide.reset(nodeID);
+}
+
+void BidirectionalBFSState::markDst(nodeID_t nodeID) {
+    dstNodeID = nodeID;
+    dstSide.reset(nodeID);
+    if (dstNodeID == srcNodeID) {
+        meetingNodeIDs.push_back(nodeID);
+    }
+}
+
+void BidirectionalBFSState::markVisited(nodeID_t boundNodeID, nodeID_t nbrNodeID, relID_t relID,
+    uint64_t multiplicity) {
+    if (!getExtendingSide().visited.insert(nbrNodeID)) {
+        // For all shortest paths, keep every edge to the nodes first reached at this level.
+        if (!allShortest || !nextFrontier->contains(nbrNodeID)) {
+            return;
+        }
+    }
+    if (trackPath) {
+        nextFrontier->addEdge(boundNodeID, nbrNodeID, relID);
+    } else {
+        nextFrontier->addNodeWithMultiplicity(nbrNodeID, allShortest ? multiplicity : 1);
+    }
+}
+
+bool BidirectionalBFSState::startNextLevel() {
+    isExtendingFromSrc = srcSide.getLastFrontier()->nodeIDs.size() <=
+                         dstSide.getLastFrontier()->nodeIDs.size();
+    auto& side = getExtendingSide();
+    currentFrontier = side.getLastFrontier();
+    side.frontiers.push_back(std::make_unique<Frontier>());
+    nextFrontier = side.getLastFrontier();
+    nextNodeIdxToExtend = 0;
+    return isExtendingFromSrc;
+}
+
+void BidirectionalBFSState::finalizeNextLevel() {
+    currentLevel++;
+    nextFrontier->sortNodeIDs();
+    // The sides have not met before this level, so the nodes reached that the other side visited
+    // are in its last frontier, and are at the same distance from src.
+    auto& otherSide = getOtherSide();
+    for (auto nodeID : nextFrontier->nodeIDs) {
+        if (otherSide.visited.contains(nodeID)) {
+            meetingNodeIDs.push_back(nodeID);
+        }
+    }
+}
+
+void BidirectionalBFSState::populatePathFrontiers() {
+    frontiers.clear();
+    if (meetingNodeIDs.empty()) {
+        return;
+    }
+    uint64_t pathLength = srcSide.getNumLevels() + dstSide.getNumLevels();
+    for (auto i = 0u; i <= pathLength; ++i) {
+        frontiers.push_back(std::make_unique<Frontier>());
+    }
+    frontiers[0]->addNodeWithMultiplicity(srcNodeID, 1 /* multiplicity */);
+    if (!allShortest) {
+        meetingNodeIDs.resize(1);
+    }
+    if (!trackPath) {
+        if (pathLength == 0) {
+            return;
+        }
+        uint64_t multiplicity = 0;
+        for (auto nodeID : meetingNodeIDs) {
+            multiplicity += srcSide.getLastFrontier()->getMultiplicity(nodeID) *
+                            dstSide.getLastFrontier()->getMultiplicity(nodeID);
+        }
+        frontiers[pathLength]->addNodeWithMultiplicity(dstNodeID, multiplicity);
+        return;
+    }
+    populatePathFrontiersFromSide(srcSide, true /* isSrcSide */, meetingNodeIDs);
+    populatePathFrontiersFromSide(dstSide, false /* isSrcSide */, meetingNodeIDs);
+}
+
+void BidirectionalBFSState::populatePathFrontiersFromSide(const Side& side, bool isSrcSide,
+    std::vector<nodeID_t> nodeIDs) {
+    auto pathLength = frontiers.size() - 1;
+    for (auto level = side.getNumLevels(); level > 0; --level) {
+        auto sideFrontier = side.frontiers[level].get();
+        // Edges of the dst side point towards dst, so they go to the next frontier of the path.
+        auto pathFrontier =
+            isSrcSide ? frontiers[level].get() : frontiers[pathLength - level + 1].get();
+        frontier::NodeIDSet prevNodeIDSet;
+        std::vector<nodeID_t> prevNodeIDs;
+        for (auto nodeID : nodeIDs) {
+            auto edgeIdx = sideFrontier->getFirstBwdEdgeIdx(nodeID);
+            while (edgeIdx != frontier::INVALID_BWD_EDGE_IDX) {
+                auto& edge = sideFrontier->getBwdEdge(edgeIdx);
+                auto& [prevNodeID, relID] = edge.nbrAndRelID;
+                if (isSrcSide) {
+                    pathFrontier->addEdge(prevNodeID, nodeID, relID);
+                } else {
+                    pathFrontier->addEdge(nodeID, prevNodeID, relID);
+                }
+                if (prevNodeIDSet.insert(prevNodeID)) {
+                    prevNodeIDs.push_back(prevNodeID);
+                }
+                // A shortest path follows a single edge.
+                edgeIdx = allShortest ? edge.nextIdx : frontier::INVALID_BWD_EDGE_IDX;
+            }
+        }
+        nodeIDs = std::move(prevNodeIDs);
+    }
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -1,24 +1,42 @@
 #include "processor/operator/recursive_extend/frontier.h"
 
+#include <algorithm>
+
 using namespace kuzu::common;
 
 namespace kuzu {
 namespace processor {
 
 void Frontier::addEdge(nodeID_t boundNodeID, nodeID_t nbrNodeID, nodeID_t relID) {
-    if (!bwdEdges.contains(nbrNodeID)) {
+    auto edgeIdx = bwdEdges.size();
+    bwdEdges.push_back(frontier::BwdEdge{{boundNodeID, relID}, frontier::INVALID_BWD_EDGE_IDX});
+    if (bwdEdgeLists.insert(nbrNodeID, frontier::BwdEdgeList{edgeIdx, edgeIdx})) {
         nodeIDs.push_back(nbrNodeID);
-        bwdEdges.insert({nbrNodeID, std::vector<frontier::node_rel_id_t>{}});
+    } else {
+        auto& edgeList = bwdEdgeLists.at(nbrNodeID);
+        bwdEdges[edgeList.tailIdx].nextIdx = edgeIdx;
+        edgeList.tailIdx = edgeIdx;
     }
-    bwdEdges.at(nbrNodeID).emplace_back(boundNodeID, relID);
 }
 
 void Frontier::addNodeWithMultiplicity(nodeID_t nodeID, uint64_t multiplicity) {
-    if (nodeIDToMultiplicity.contains(nodeID)) {
+    if (nodeIDToMultiplicity.insert(nodeID, multiplicity)) {
+        nodeIDs.push_back(nodeID);
+    } else {
         nodeIDToMultiplicity.at(nodeID) += multiplicity;
+    }
+}
+
+void Frontier::sortNodeIDs() {
+    // Dense maps list their nodes in order, which is cheaper than sorting large frontiers.
+    if (bwdEdgeLists.isDense() && bwdEdgeLists.size() == nodeIDs.size()) {
+        nodeIDs.clear();
+        bwdEdgeLists.appendNodeIDs(nodeIDs);
+    } else if (nodeIDToMultiplicity.isDense() && nodeIDToMultiplicity.size() == nodeIDs.size()) {
+        nodeIDs.clear();
+        nodeIDToMultiplicity.appendNodeIDs(nodeIDs);
     } else {
-        nodeIDToMultiplicity.insert({nodeID, multiplicity});
-        nodeIDs.push_back(nodeID);
+        std::sort(nodeIDs.begin(), nodeIDs.end());
     }
 }
 
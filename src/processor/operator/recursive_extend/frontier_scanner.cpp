@@ -56,11 +56,15 @@ void PathScanner::scanFromDstOffset(RecursiveJoinVectors* vectors, sel_t& vector
     }
 
     auto level = 0;
-    while (!nbrsStack.empty()) {
+    while (!cursorStack.empty()) {
         auto& cursor = cursorStack.top();
-        cursor++;
-        if ((uint64_t)cursor < nbrsStack.top()->size()) { // Found a new nbr
-            auto& nbr = nbrsStack.top()->at(cursor);
+        // The edges on top of the stack are the bwd edges of a node in frontier level + 1.
+        auto nbrFrontier = frontiers[level + 1];
+        cursor.edgeIdx = cursor.edgeIdx == frontier::INVALID_BWD_EDGE_IDX ?
+                             cursor.firstEdgeIdx :
+                             nbrFrontier->getBwdEdge(cursor.edgeIdx).nextIdx;
+        if (cursor.edgeIdx != frontier::INVALID_BWD_EDGE_IDX) { // Found a new nbr
+            auto& nbr = nbrFrontier->getBwdEdge(cursor.edgeIdx).nbrAndRelID;
             nodeIDs[level] = nbr.first;
             relIDs[level] = nbr.second;
             if (level == 0) { // Found a new nbr at level 0. Found a new path.
@@ -71,12 +75,11 @@ void PathScanner::scanFromDstOffset(RecursiveJoinVectors* vectors, sel_t& vector
                 continue;
             }
             // Push new stack.
-            cursorStack.push(-1);
-            nbrsStack.push(&frontiers[level]->bwdEdges.at(nbr.first));
+            cursorStack.push(BwdEdgeCursor{frontiers[level]->getFirstBwdEdgeIdx(nbr.first),
+                frontier::INVALID_BWD_EDGE_IDX});
             level--;
         } else { // Failed to find a nbr. Pop stack.
             cursorStack.pop();
-            nbrsStack.pop();
             level++;
         }
     }
@@ -89,13 +92,12 @@ void PathScanner::initDfs(const frontier::node_rel_id_t& nodeAndRelID, size_t cu
         return;
     }
     if (currentDepth == 0) {
-        cursorStack.top() = -1;
+        cursorStack.top().edgeIdx = frontier::INVALID_BWD_EDGE_IDX;
         return;
     }
-    auto nbrs = &frontiers[currentDepth]->bwdEdges.at(nodeAndRelID.first);
-    nbrsStack.push(nbrs);
-    cursorStack.push(0);
-    initDfs(nbrs->at(0), currentDepth - 1);
+    auto firstEdgeIdx = frontiers[currentDepth]->getFirstBwdEdgeIdx(nodeAndRelID.first);
+    cursorStack.push(BwdEdgeCursor{firstEdgeIdx, firstEdgeIdx});
+    initDfs(frontiers[currentDepth]->getBwdEdge(firstEdgeIdx).nbrAndRelID, currentDepth - 1);
 }
 
 void PathScanner::writePathToVector(RecursiveJoinVectors* vectors, sel_t& vectorPos,
@@ -0,0 +1,55 @@
+#include "processor/operator/recursive_extend/parallel_frontier.h"
+
+#include "common/assert.h"
+
+namespace kuzu {
+namespace processor {
+
+ParallelFrontierLevel::ParallelFrontierLevel(const common::nodeID_t* nodeIDs, uint64_t numNodes,
+    bool executeNodePredicate)
+    : nodeIDs{nodeIDs}, numNodes{numNodes}, executeNodePredicate{executeNodePredicate},
+      nextMorselIdx{0} {
+    morsels.resize((numNodes + MORSEL_SIZE - 1) / MORSEL_SIZE);
+}
+
+bool ParallelFrontierLevel::getMorsel(uint64_t& morselIdx) {
+    if (!hasMorselsLeft()) {
+        return false;
+    }
+    morselIdx = nextMorselIdx.fetch_add(1);
+    return morselIdx < morsels.size();
+}
+
+void ParallelFrontierLevel::finishMorsel(uint64_t morselIdx, std::vector<FrontierEdge> edges,
+    std::exception_ptr exception) {
+    std::unique_lock lck{mtx};
+    auto& morsel = morsels[morselIdx];
+    morsel.edges = std::move(edges);
+    morsel.exception = std::move(exception);
+    morsel.finished = true;
+    lck.unlock();
+    cv.notify_all();
+}
+
+bool ParallelFrontierLevel::isMorselFinished(uint64_t morselIdx) {
+    std::unique_lock lck{mtx};
+    return morsels[morselIdx].finished;
+}
+
+std::vector<FrontierEdge> ParallelFrontierLevel::takeMorselEdges(uint64_t morselIdx) {
+    std::unique_lock lck{mtx};
+    auto& morsel = morsels[morselIdx];
+    cv.wait(lck, [&] { return morsel.finished; });
+    if (morsel.exception) {
+        std::rethrow_exception(morsel.exception);
+    }
+    return std::move(morsel.edges);
+}
+
+uint64_t ParallelFrontierLevel::close() {
+    auto numMorselsHandedOut = nextMorselIdx.exchange(morsels.size());
+    return std::min<uint64_t>(numMorselsHandedOut, morsels.size());
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -1,5 +1,7 @@
 #include "processor/operator/recursive_extend/recursive_join.h"
 
+#include "common/exception/runtime.h"
+#include "common/type_utils.h"
 #include "processor/operator/recursive_extend/all_shortest_path_state.h"
 #include "processor/operator/recursive_extend/scan_frontier.h"
 #include "processor/operator/recursive_extend/shortest_path_state.h"
@@ -10,6 +12,55 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace processor {
 
+void RecursiveJoinSharedState::registerThreadWithSources() {
+    std::unique_lock lck{mtx};
+    numThreadsWithSources++;
+}
+
+void RecursiveJoinSharedState::deregisterThreadWithSources() {
+    std::unique_lock lck{mtx};
+    numThreadsWithSources--;
+    lck.unlock();
+    cv.notify_all();
+}
+
+void RecursiveJoinSharedState::addLevel(std::shared_ptr<ParallelFrontierLevel> level) {
+    std::unique_lock lck{mtx};
+    levels.push_back(std::move(level));
+    lck.unlock();
+    cv.notify_all();
+}
+
+void RecursiveJoinSharedState::removeLevel(ParallelFrontierLevel* level) {
+    std::unique_lock lck{mtx};
+    std::erase_if(levels, [&](auto& other) { return other.get() == level; });
+}
+
+std::shared_ptr<ParallelFrontierLevel> RecursiveJoinSharedState::getLevelToHelp() {
+    std::unique_lock lck{mtx};
+    std::shared_ptr<ParallelFrontierLevel> levelToHelp = nullptr;
+    numIdleThreads++;
+    cv.wait(lck, [&] {
+        for (auto& level : levels) {
+            if (level->hasMorselsLeft()) {
+                levelToHelp = level;
+                return true;
+            }
+        }
+        return numThreadsWithSources == 0;
+    });
+    numIdleThreads--;
+    return levelToHelp;
+}
+
+RecursiveJoin::~RecursiveJoin() {
+    // Threads can stop pulling from the recursive join before its sources are exhausted, e.g.
+    // because of a limit or an exception. Let the threads waiting to help know.
+    if (hasSources) {
+        sharedState->deregisterThreadWithSources();
+    }
+}
+
 void RecursiveJoin::initLocalStateInternal(ResultSet* /*resultSet_*/, ExecutionContext* context) {
     populateTargetDstNodes(context);
     vectors = std::make_unique<RecursiveJoinVectors>();
@@ -87,6 +138,29 @@ void RecursiveJoin::initLocalStateInternal(ResultSet* /*resultSet_*/, ExecutionC
             KU_UNREACHABLE;
         }
     } break;
+    case QueryRelType::WEIGHTED_SHORTEST: {
+        switch (joinType) {
+        case planner::RecursiveJoinType::TRACK_PATH: {
+            vectors->pathVector = resultSet->getValueVector(dataInfo->pathPos).get();
+            weightedState = std::make_unique<WeightedShortestPathState>(upperBound,
+                targetDstNodes.get(), true /* trackPath */);
+            for (auto i = lowerBound; i <= upperBound; ++i) {
+                scanners.push_back(std::make_unique<PathScanner>(targetDstNodes.get(), i,
+                    dataInfo->tableIDToName));
+            }
+        } break;
+        case planner::RecursiveJoinType::TRACK_NONE: {
+            weightedState = std::make_unique<WeightedShortestPathState>(upperBound,
+                targetDstNodes.get(), false /* trackPath */);
+            for (auto i = lowerBound; i <= upperBound; ++i) {
+                scanners.push_back(
+                    std::make_unique<DstNodeWithMultiplicityScanner>(targetDstNodes.get(), i));
+            }
+        } break;
+        default:
+            KU_UNREACHABLE;
+        }
+    } break;
     default:
         KU_UNREACHABLE;
     }
@@ -128,6 +202,15 @@ void RecursiveJoin::initLocalStateInternal(ResultSet* /*resultSet_*/, ExecutionC
     }
     frontiersScanner = std::make_unique<FrontiersScanner>(std::move(scanners));
     initLocalRecursivePlan(context);
+    if (bwdRecursiveRoot != nullptr && singleTargetDstNodeID.offset != INVALID_OFFSET &&
+        dataInfo->recursiveDstNodeTableIDs.contains(singleTargetDstNodeID.tableID)) {
+        KU_ASSERT(queryRelType == QueryRelType::SHORTEST ||
+                  queryRelType == QueryRelType::ALL_SHORTEST);
+        bidirectionalState = std::make_unique<BidirectionalBFSState>(upperBound,
+            targetDstNodes.get(), joinType == planner::RecursiveJoinType::TRACK_PATH,
+            queryRelType == QueryRelType::ALL_SHORTEST);
+        initLocalBwdRecursivePlan(context);
+    }
 }
 
 bool RecursiveJoin::getNextTuplesInternal(ExecutionContext* context) {
@@ -145,13 +228,38 @@ bool RecursiveJoin::getNextTuplesInternal(ExecutionContext* context) {
     // These 2 steps are repeated iteratively until all sources to do a BFS are exhausted. The first
     // if statement checks if we are in the outputting phase and if so, scans a vector to output and
     // returns true. Otherwise, we compute a new BFS.
+    //
+    // Once the sources of the thread are exhausted, the thread helps other threads extend the
+    // frontiers of their BFS.
+    if (!hasSources && !sourcesExhausted) {
+        sharedState->registerThreadWithSources();
+        hasSources = true;
+    }
     while (true) {
         if (scanOutput()) { // Phase 2
             return true;
         }
-        if (!children[0]->getNextTuple(context)) {
+        if (sourcesExhausted || !children[0]->getNextTuple(context)) {
+            if (hasSources) {
+                hasSources = false;
+                sourcesExhausted = true;
+                sharedState->deregisterThreadWithSources();
+                helpOtherThreads(context);
+            }
             return false;
         }
+        if (bidirectionalState != nullptr) {
+            bidirectionalState->resetState();
+            computeBidirectionalBFS(context); // Phase 1
+            frontiersScanner->resetState(*bidirectionalState);
+            continue;
+        }
+        if (weightedState != nullptr) {
+            weightedState->resetState();
+            computeWeightedShortestPaths(context); // Phase 1
+            frontiersScanner->resetState(*weightedState);
+            continue;
+        }
         bfsState->resetState();
         computeBFS(context); // Phase 1
         frontiersScanner->resetState(*bfsState);
@@ -180,6 +288,11 @@ void RecursiveJoin::computeBFS(ExecutionContext* context) {
     bfsState->markSrc(nodeID);
     scanFrontier->setNodePredicateExecFlag(true);
     while (!bfsState->isComplete()) {
+        if (bfsState->getNumNodeIDsToExtend() >= 2 * ParallelFrontierLevel::MORSEL_SIZE &&
+            sharedState->hasIdleThreads()) {
+            extendCurrentFrontierInParallel(context);
+            continue;
+        }
         auto boundNodeID = bfsState->getNextNodeID();
         if (boundNodeID.offset != INVALID_OFFSET) {
             // Found a starting node from current frontier.
@@ -205,6 +318,174 @@ void RecursiveJoin::updateVisitedNodes(nodeID_t boundNodeID) {
     }
 }
 
+void RecursiveJoin::computeBidirectionalBFS(ExecutionContext* context) {
+    auto nodeID = vectors->srcNodeIDVector->getValue<nodeID_t>(
+        vectors->srcNodeIDVector->state->selVector->selectedPositions[0]);
+    bidirectionalState->markSrc(nodeID);
+    bidirectionalState->markDst(singleTargetDstNodeID);
+    while (!bidirectionalState->isComplete()) {
+        auto isExtendingFromSrc = bidirectionalState->startNextLevel();
+        auto root = isExtendingFromSrc ? recursiveRoot.get() : bwdRecursiveRoot.get();
+        auto frontierScan = isExtendingFromSrc ? scanFrontier : bwdScanFrontier;
+        auto dstNodeIDVector = isExtendingFromSrc ? vectors->recursiveDstNodeIDVector :
+                                                    vectors->bwdRecursiveDstNodeIDVector;
+        auto edgeIDVector = isExtendingFromSrc ? vectors->recursiveEdgeIDVector :
+                                                 vectors->bwdRecursiveEdgeIDVector;
+        auto boundNodeID = bidirectionalState->getNextNodeID();
+        while (boundNodeID.offset != INVALID_OFFSET) {
+            auto boundNodeMultiplicity = bidirectionalState->getMultiplicity(boundNodeID);
+            frontierScan->setNodeID(boundNodeID);
+            while (root->getNextTuple(context)) {
+                auto selVector = dstNodeIDVector->state->selVector.get();
+                for (auto i = 0u; i < selVector->selectedSize; ++i) {
+                    auto pos = selVector->selectedPositions[i];
+                    bidirectionalState->markVisited(boundNodeID,
+                        dstNodeIDVector->getValue<nodeID_t>(pos),
+                        edgeIDVector->getValue<relID_t>(pos), boundNodeMultiplicity);
+                }
+            }
+            boundNodeID = bidirectionalState->getNextNodeID();
+        }
+        bidirectionalState->finalizeNextLevel();
+    }
+    bidirectionalState->populatePathFrontiers();
+}
+
+static double getRelWeight(ValueVector* weightVector, uint32_t pos) {
+    double weight = 0;
+    TypeUtils::visit(
+        weightVector->dataType.getPhysicalType(),
+        [&](int128_t) { weight = Int128_t::Cast<double>(weightVector->getValue<int128_t>(pos)); },
+        [&]<typename T>(T)
+            requires(std::integral<T> || std::floating_point<T>)
+        { weight = weightVector->getValue<T>(pos); },
+        [](auto) { KU_UNREACHABLE; });
+    if (weight < 0) {
+        throw RuntimeException("Cannot compute weighted shortest paths with negative rel weights.");
+    }
+    return weight;
+}
+
+void RecursiveJoin::computeWeightedShortestPaths(ExecutionContext* context) {
+    auto nodeID = vectors->srcNodeIDVector->getValue<nodeID_t>(
+        vectors->srcNodeIDVector->state->selVector->selectedPositions[0]);
+    weightedState->markSrc(nodeID);
+    scanFrontier->setNodePredicateExecFlag(true);
+    while (!weightedState->isComplete()) {
+        auto boundNodeID = weightedState->settleNextNode();
+        scanFrontier->setNodeID(boundNodeID);
+        while (recursiveRoot->getNextTuple(context)) {
+            auto selVector = vectors->recursiveDstNodeIDVector->state->selVector.get();
+            for (auto i = 0u; i < selVector->selectedSize; ++i) {
+                auto pos = selVector->selectedPositions[i];
+                // Rels without a weight cannot be traversed.
+                if (vectors->recursiveWeightVector->isNull(pos)) {
+                    continue;
+                }
+                weightedState->relaxRel(boundNodeID,
+                    vectors->recursiveDstNodeIDVector->getValue<nodeID_t>(pos),
+                    vectors->recursiveEdgeIDVector->getValue<relID_t>(pos),
+                    getRelWeight(vectors->recursiveWeightVector, pos));
+            }
+        }
+        scanFrontier->setNodePredicateExecFlag(false);
+    }
+    weightedState->populatePathFrontiers();
+}
+
+void RecursiveJoin::extendCurrentFrontierInParallel(ExecutionContext* context) {
+    auto [nodeIDs, numNodeIDs] = bfsState->takeNodeIDsToExtend();
+    auto level = std::make_shared<ParallelFrontierLevel>(nodeIDs, numNodeIDs,
+        bfsState->getCurrentLevel() == 0 /* executeNodePredicate */);
+    sharedState->addLevel(level);
+    uint64_t numMorselsApplied = 0;
+    auto isComplete = false;
+    try {
+        uint64_t morselIdx = 0;
+        while (level->getMorsel(morselIdx)) {
+            extendMorsel(*level, morselIdx, context);
+            // Apply edges as soon as all preceding morsels are applied, to keep the order of the
+            // sequential BFS.
+            while (!isComplete && numMorselsApplied <= morselIdx &&
+                   level->isMorselFinished(numMorselsApplied)) {
+                isComplete = applyFrontierEdges(level->takeMorselEdges(numMorselsApplied++));
+            }
+            if (isComplete) {
+                break;
+            }
+        }
+        auto numMorsels = level->close();
+        sharedState->removeLevel(level.get());
+        while (numMorselsApplied < numMorsels) {
+            auto edges = level->takeMorselEdges(numMorselsApplied++);
+            if (!isComplete) {
+                isComplete = applyFrontierEdges(edges);
+            }
+        }
+    } catch (...) {
+        // Other threads may still read the frontier, which goes away with the BFS state.
+        auto numMorsels = level->close();
+        sharedState->removeLevel(level.get());
+        for (auto i = numMorselsApplied; i < numMorsels; i++) {
+            try {
+                level->takeMorselEdges(i);
+            } catch (...) {} // NOLINT(bugprone-empty-catch): the first exception is rethrown.
+        }
+        throw;
+    }
+}
+
+bool RecursiveJoin::applyFrontierEdges(const std::vector<FrontierEdge>& edges) {
+    uint64_t boundNodeMultiplicity = 0;
+    for (auto i = 0u; i < edges.size(); i++) {
+        auto& edge = edges[i];
+        if (i == 0 || edge.boundNodeID != edges[i - 1].boundNodeID) {
+            // The sequential BFS checks for completion before extending each node.
+            if (bfsState->isComplete()) {
+                return true;
+            }
+            boundNodeMultiplicity = bfsState->getMultiplicity(edge.boundNodeID);
+        }
+        bfsState->markVisited(edge.boundNodeID, edge.nbrNodeID, edge.relID, boundNodeMultiplicity);
+    }
+    return bfsState->isComplete();
+}
+
+void RecursiveJoin::extendMorsel(ParallelFrontierLevel& level, uint64_t morselIdx,
+    ExecutionContext* context) {
+    std::vector<FrontierEdge> edges;
+    try {
+        scanFrontier->setNodePredicateExecFlag(level.shouldExecuteNodePredicate());
+        auto nodeIDs = level.getMorselNodeIDs(morselIdx);
+        for (auto i = 0u; i < level.getMorselSize(morselIdx); i++) {
+            auto boundNodeID = nodeIDs[i];
+            scanFrontier->setNodeID(boundNodeID);
+            while (recursiveRoot->getNextTuple(context)) {
+                auto selVector = vectors->recursiveDstNodeIDVector->state->selVector.get();
+                for (auto j = 0u; j < selVector->selectedSize; ++j) {
+                    auto pos = selVector->selectedPositions[j];
+                    edges.push_back(FrontierEdge{boundNodeID,
+                        vectors->recursiveDstNodeIDVector->getValue<nodeID_t>(pos),
+                        vectors->recursiveEdgeIDVector->getValue<relID_t>(pos)});
+                }
+            }
+        }
+    } catch (...) {
+        level.finishMorsel(morselIdx, {}, std::current_exception());
+        return;
+    }
+    level.finishMorsel(morselIdx, std::move(edges), nullptr);
+}
+
+void RecursiveJoin::helpOtherThreads(ExecutionContext* context) {
+    while (auto level = sharedState->getLevelToHelp()) {
+        uint64_t morselIdx = 0;
+        while (level->getMorsel(morselIdx)) {
+            extendMorsel(*level, morselIdx, context);
+        }
+    }
+}
+
 void RecursiveJoin::initLocalRecursivePlan(ExecutionContext* context) {
     auto op = recursiveRoot.get();
     while (!op->isSource()) {
@@ -218,27 +499,50 @@ void RecursiveJoin::initLocalRecursivePlan(ExecutionContext* context) {
         localResultSet->getValueVector(dataInfo->recursiveDstNodeIDPos).get();
     vectors->recursiveEdgeIDVector =
         localResultSet->getValueVector(dataInfo->recursiveEdgeIDPos).get();
+    if (dataInfo->recursiveWeightPos.isValid()) {
+        vectors->recursiveWeightVector =
+            localResultSet->getValueVector(dataInfo->recursiveWeightPos).get();
+    }
     recursiveRoot->initLocalState(localResultSet.get(), context);
 }
 
+void RecursiveJoin::initLocalBwdRecursivePlan(ExecutionContext* context) {
+    auto op = bwdRecursiveRoot.get();
+    while (!op->isSource()) {
+        KU_ASSERT(op->getNumChildren() == 1);
+        op = op->getChild(0);
+    }
+    bwdScanFrontier = (ScanFrontier*)op;
+    bwdLocalResultSet = std::make_unique<ResultSet>(dataInfo->bwdLocalResultSetDescriptor.get(),
+        context->clientContext->getMemoryManager());
+    vectors->bwdRecursiveDstNodeIDVector =
+        bwdLocalResultSet->getValueVector(dataInfo->bwdRecursiveDstNodeIDPos).get();
+    vectors->bwdRecursiveEdgeIDVector =
+        bwdLocalResultSet->getValueVector(dataInfo->bwdRecursiveEdgeIDPos).get();
+    bwdRecursiveRoot->initLocalState(bwdLocalResultSet.get(), context);
+}
+
 void RecursiveJoin::populateTargetDstNodes(ExecutionContext* context) {
-    frontier::node_id_set_t targetNodeIDs;
+    frontier::NodeIDSet targetNodeIDs;
     uint64_t numTargetNodes = 0;
+    singleTargetDstNodeID = nodeID_t{INVALID_OFFSET, INVALID_TABLE_ID};
     for (auto& semiMask : sharedState->semiMasks) {
         auto nodeTable = semiMask->getNodeTable();
         auto numNodes = nodeTable->getMaxNodeOffset(context->clientContext->getTx()) + 1;
         if (semiMask->isEnabled()) {
-            for (auto offset = 0u; offset < numNodes; ++offset) {
-                if (semiMask->isNodeMasked(offset)) {
-                    targetNodeIDs.insert(nodeID_t{offset, nodeTable->getTableID()});
-                    numTargetNodes++;
-                }
-            }
+            semiMask->forEachMaskedNode(0 /* startOffset */, numNodes, [&](offset_t offset) {
+                singleTargetDstNodeID = nodeID_t{offset, nodeTable->getTableID()};
+                targetNodeIDs.insert(singleTargetDstNodeID);
+                numTargetNodes++;
+            });
         } else {
             KU_ASSERT(targetNodeIDs.empty());
             numTargetNodes += numNodes;
         }
     }
+    if (numTargetNodes != 1) {
+        singleTargetDstNodeID = nodeID_t{INVALID_OFFSET, INVALID_TABLE_ID};
+    }
     targetDstNodes = std::make_unique<TargetDstNodes>(numTargetNodes, std::move(targetNodeIDs));
     for (auto tableID : dataInfo->recursiveDstNodeTableIDs) {
         if (!dataInfo->dstNodeTableIDs.contains(tableID)) {
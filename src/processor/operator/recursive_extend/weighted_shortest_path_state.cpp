@@ -0,0 +1,83 @@
+#include "processor/operator/recursive_extend/weighted_shortest_path_state.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+void WeightedShortestPathState::resetState() {
+    currentLevel = 0;
+    nextNodeIdxToExtend = 0;
+    frontiers.clear();
+    nodeStates.clear();
+    queue = {};
+    settledNodeIDs.clear();
+    numSettledDstNodes = 0;
+}
+
+bool WeightedShortestPathState::isComplete() {
+    while (!queue.empty() && nodeStates.at(queue.top().second).settled) {
+        queue.pop();
+    }
+    return queue.empty() || numSettledDstNodes == targetDstNodes->getNumNodes();
+}
+
+void WeightedShortestPathState::markSrc(nodeID_t nodeID) {
+    auto invalidID = nodeID_t{INVALID_OFFSET, INVALID_TABLE_ID};
+    nodeStates.insert(nodeID, NodeState{0, invalidID, invalidID, 0, false /* settled */});
+    queue.emplace(0, nodeID);
+}
+
+nodeID_t WeightedShortestPathState::settleNextNode() {
+    KU_ASSERT(!queue.empty());
+    auto [distance, nodeID] = queue.top();
+    queue.pop();
+    auto& state = nodeStates.at(nodeID);
+    KU_ASSERT(!state.settled && state.distance == distance);
+    state.settled = true;
+    boundDistance = distance;
+    boundNumRels = state.numRels;
+    settledNodeIDs.push_back(nodeID);
+    if (targetDstNodes->contains(nodeID)) {
+        numSettledDstNodes++;
+    }
+    return nodeID;
+}
+
+void WeightedShortestPathState::relaxRel(nodeID_t boundNodeID, nodeID_t nbrNodeID, relID_t relID,
+    double weight) {
+    KU_ASSERT(weight >= 0);
+    auto nbrState = NodeState{boundDistance + weight, boundNodeID, relID, boundNumRels + 1,
+        false /* settled */};
+    if (!nodeStates.insert(nbrNodeID, nbrState)) {
+        auto& state = nodeStates.at(nbrNodeID);
+        if (state.settled || nbrState.distance >= state.distance) {
+            return;
+        }
+        state = nbrState;
+    }
+    queue.emplace(nbrState.distance, nbrNodeID);
+}
+
+void WeightedShortestPathState::populatePathFrontiers() {
+    frontiers.clear();
+    frontiers.push_back(std::make_unique<Frontier>());
+    // Nodes are settled after the parent node on their path, which is in the previous frontier.
+    for (auto nodeID : settledNodeIDs) {
+        auto& state = nodeStates.at(nodeID);
+        if (state.numRels > upperBound) {
+            continue;
+        }
+        while (frontiers.size() <= state.numRels) {
+            frontiers.push_back(std::make_unique<Frontier>());
+        }
+        if (trackPath && state.numRels > 0) {
+            frontiers[state.numRels]->addEdge(state.parentNodeID, nodeID, state.relID);
+        } else {
+            frontiers[state.numRels]->addNodeWithMultiplicity(nodeID, 1 /* multiplicity */);
+        }
+    }
+}
+
+} // namespace processor
+} // namespace kuzu
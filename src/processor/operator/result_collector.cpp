@@ -8,26 +8,36 @@ namespace processor {
 
 void ResultCollector::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     payloadVectors.reserve(info->payloadPositions.size());
-    for (auto& pos : info->payloadPositions) {
+    for (auto i = 0u; i < info->payloadPositions.size(); i++) {
+        auto& pos = info->payloadPositions[i];
         payloadVectors.push_back(resultSet->getValueVector(pos).get());
+        if (!info->tableSchema->getColumn(i)->isFlat()) {
+            unflatDataChunksPos.insert(pos.dataChunkPos);
+        }
     }
     localTable = std::make_unique<FactorizedTable>(context->clientContext->getMemoryManager(),
         info->tableSchema->copy());
 }
 
 void ResultCollector::executeInternal(ExecutionContext* context) {
-    while (children[0]->getNextTuple(context)) {
-        if (!payloadVectors.empty()) {
-            for (auto i = 0u; i < resultSet->multiplicity; i++) {
-                localTable->append(payloadVectors);
-            }
-        }
-    }
+    while (collectNextTuples(*localTable, context)) {}
     if (!payloadVectors.empty()) {
         sharedState->mergeLocalTable(*localTable);
     }
 }
 
+bool ResultCollector::collectNextTuples(FactorizedTable& table, ExecutionContext* context) {
+    if (!children[0]->getNextTuple(context)) {
+        return false;
+    }
+    if (!payloadVectors.empty()) {
+        for (auto i = 0u; i < resultSet->multiplicity; i++) {
+            table.append(payloadVectors);
+        }
+    }
+    return true;
+}
+
 void ResultCollector::finalize(ExecutionContext* /*context*/) {
     switch (info->accumulateType) {
     case AccumulateType::OPTIONAL_: {
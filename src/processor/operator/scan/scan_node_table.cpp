@@ -1,21 +1,86 @@
 #include "processor/operator/scan/scan_node_table.h"
 
+#include "function/hash/vector_hash_functions.h"
+#include "storage/storage_utils.h"
+
 using namespace kuzu::common;
 
 namespace kuzu {
 namespace processor {
 
+void ScanSingleNodeTable::initLocalStateInternal(ResultSet* resultSet,
+    ExecutionContext* executionContext) {
+    ScanTable::initLocalStateInternal(resultSet, executionContext);
+    readState = std::make_unique<storage::TableReadState>(*inVector, info->columnIDs, outVectors);
+    if (info->bloomFilter != nullptr) {
+        keyHashVector = std::make_unique<ValueVector>(LogicalTypeID::INT64,
+            executionContext->clientContext->getMemoryManager());
+    }
+}
+
 bool ScanSingleNodeTable::getNextTuplesInternal(ExecutionContext* context) {
-    if (!children[0]->getNextTuple(context)) {
-        return false;
+    if (info->bloomFilter == nullptr) {
+        do {
+            if (!children[0]->getNextTuple(context)) {
+                return false;
+            }
+        } while (canSkipInput(context->clientContext->getTx()));
+        scan(context);
+        return true;
     }
+    auto keyVector = outVectors[info->bloomFilterKeyIdx];
+    do {
+        restoreSelVector(keyVector->state->selVector);
+        do {
+            if (!children[0]->getNextTuple(context)) {
+                return false;
+            }
+        } while (canSkipInput(context->clientContext->getTx()));
+        saveSelVector(keyVector->state->selVector);
+        scan(context);
+    } while (!applyBloomFilter());
+    return true;
+}
+
+void ScanSingleNodeTable::scan(ExecutionContext* context) {
     for (auto& outputVector : outVectors) {
         outputVector->resetAuxiliaryBuffer();
     }
     info->table->initializeReadState(context->clientContext->getTx(), info->columnIDs, *inVector,
         *readState);
     info->table->read(context->clientContext->getTx(), *readState);
-    return true;
+}
+
+bool ScanSingleNodeTable::applyBloomFilter() {
+    auto keyVector = outVectors[info->bloomFilterKeyIdx];
+    function::VectorHashFunction::computeHash(keyVector, keyHashVector.get());
+    auto& selVector = keyVector->state->selVector;
+    if (keyVector->state->isFlat()) {
+        auto pos = selVector->selectedPositions[0];
+        return !keyVector->isNull(pos) &&
+               info->bloomFilter->mayContain(keyHashVector->getValue<hash_t>(pos));
+    }
+    auto numSelectedValues = 0u;
+    auto buffer = selVector->getMultableBuffer();
+    for (auto i = 0u; i < selVector->selectedSize; i++) {
+        auto pos = selVector->selectedPositions[i];
+        buffer[numSelectedValues] = pos;
+        numSelectedValues += !keyVector->isNull(pos) &&
+                             info->bloomFilter->mayContain(keyHashVector->getValue<hash_t>(pos));
+    }
+    selVector->setToFiltered();
+    selVector->selectedSize = numSelectedValues;
+    return numSelectedValues > 0;
+}
+
+bool ScanSingleNodeTable::canSkipInput(transaction::Transaction* transaction) const {
+    // Only sequential input (a morsel from ScanNodeID) is guaranteed to come from a single node
+    // group.
+    if (info->predicates.empty() || !inVector->isSequential()) {
+        return false;
+    }
+    auto nodeGroupIdx = storage::StorageUtils::getNodeGroupIdx(inVector->readNodeOffset(0));
+    return info->table->canSkipNodeGroup(transaction, nodeGroupIdx, info->predicates);
 }
 
 } // namespace processor
@@ -1,5 +1,7 @@
 #include "processor/operator/scan_node_id.h"
 
+#include "common/task_system/task_scheduler.h"
+
 using namespace kuzu::common;
 using namespace kuzu::transaction;
 
@@ -63,6 +65,11 @@ void ScanNodeID::initLocalStateInternal(ResultSet* resultSet, ExecutionContext*
 }
 
 bool ScanNodeID::getNextTuplesInternal(ExecutionContext* context) {
+    // Morsel boundaries are where the thread can leave the pipeline to a task of another query:
+    // the threads left keep grabbing the remaining ranges.
+    if (TaskScheduler::shouldYieldCurrentTask()) {
+        return false;
+    }
     do {
         auto [state, startOffset, endOffset] = sharedState->getNextRangeToRead();
         if (state == nullptr) {
@@ -94,10 +101,8 @@ void ScanNodeID::setSelVector(ExecutionContext* context, NodeTableScanState* tab
         // endOffset. If the node is masked (i.e., valid for read), then it is set to the selected
         // positions. Finally, we update the selectedSize for selVector.
         sel_t numSelectedValues = 0;
-        for (auto i = 0u; i < (endOffset - startOffset); i++) {
-            buffer[numSelectedValues] = i;
-            numSelectedValues += tableState->getSemiMask()->isNodeMasked(i + startOffset);
-        }
+        tableState->getSemiMask()->forEachMaskedNode(startOffset, endOffset,
+            [&](offset_t offset) { buffer[numSelectedValues++] = offset - startOffset; });
         outValueVector->state->selVector->selectedSize = numSelectedValues;
         if (prevSelectedSize != numSelectedValues) {
             outValueVector->state->selVector->setToFiltered();
@@ -2,7 +2,6 @@
 
 #include "processor/operator/result_collector.h"
 #include "processor/operator/sink.h"
-#include "processor/processor_task.h"
 
 using namespace kuzu::common;
 using namespace kuzu::storage;
@@ -15,6 +14,25 @@ QueryProcessor::QueryProcessor(uint64_t numThreads) {
 }
 
 std::shared_ptr<FactorizedTable> QueryProcessor::execute(PhysicalPlan* physicalPlan,
+    ExecutionContext* context) {
+    auto task = decomposePlan(physicalPlan, context);
+    context->clientContext->getProgressBar()->startProgress();
+    taskScheduler->scheduleTaskAndWaitOrError(task, context);
+    context->clientContext->getProgressBar()->endProgress();
+    auto resultCollector = ku_dynamic_cast<Sink*, ResultCollector*>(task->sink);
+    return resultCollector->getResultFactorizedTable();
+}
+
+void QueryProcessor::executeDependencies(PhysicalPlan* physicalPlan, ExecutionContext* context) {
+    auto task = decomposePlan(physicalPlan, context);
+    context->clientContext->getProgressBar()->startProgress();
+    for (auto& child : task->children) {
+        taskScheduler->scheduleTaskAndWaitOrError(child, context);
+    }
+    context->clientContext->getProgressBar()->endProgress();
+}
+
+std::shared_ptr<ProcessorTask> QueryProcessor::decomposePlan(PhysicalPlan* physicalPlan,
     ExecutionContext* context) {
     auto lastOperator = physicalPlan->lastOperator.get();
     auto resultCollector = ku_dynamic_cast<PhysicalOperator*, ResultCollector*>(lastOperator);
@@ -25,10 +43,7 @@ std::shared_ptr<FactorizedTable> QueryProcessor::execute(PhysicalPlan* physicalP
     auto task = std::make_shared<ProcessorTask>(resultCollector, context);
     decomposePlanIntoTask(lastOperator->getChild(0), task.get(), context);
     initTask(task.get());
-    context->clientContext->getProgressBar()->startProgress();
-    taskScheduler->scheduleTaskAndWaitOrError(task, context);
-    context->clientContext->getProgressBar()->endProgress();
-    return resultCollector->getResultFactorizedTable();
+    return task;
 }
 
 void QueryProcessor::decomposePlanIntoTask(PhysicalOperator* op, Task* task,
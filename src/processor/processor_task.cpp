@@ -10,7 +10,9 @@ namespace processor {
 ProcessorTask::ProcessorTask(Sink* sink, ExecutionContext* executionContext)
     : Task{executionContext->clientContext->getCurrentSetting(main::ThreadsSetting::name)
                .getValue<uint64_t>()},
-      sharedStateInitialized{false}, sink{sink}, executionContext{executionContext} {}
+      sharedStateInitialized{false}, sink{sink}, executionContext{executionContext} {
+    setPriority(executionContext->clientContext->getClientConfig()->queryPriority);
+}
 
 void ProcessorTask::run() {
     // We need the lock when cloning because multiple threads can be accessing to clone,
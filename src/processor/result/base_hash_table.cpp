@@ -20,6 +20,20 @@ BaseHashTable::BaseHashTable(storage::MemoryManager& memoryManager, logical_type
     initTmpHashVector();
 }
 
+void BaseHashTable::pinBuffers() {
+    for (auto& block : hashSlotsBlocks) {
+        block->pin();
+    }
+    factorizedTable->pinBuffers();
+}
+
+void BaseHashTable::unpinBuffers() {
+    for (auto& block : hashSlotsBlocks) {
+        block->unpin();
+    }
+    factorizedTable->unpinBuffers();
+}
+
 void BaseHashTable::setMaxNumHashSlots(uint64_t newSize) {
     maxNumHashSlots = newSize;
     bitmask = maxNumHashSlots - 1;
@@ -106,6 +106,18 @@ void DataBlockCollection::merge(DataBlockCollection& other) {
     }
 }
 
+void DataBlockCollection::pinBlocks() {
+    for (auto& block : blocks) {
+        block->pin();
+    }
+}
+
+void DataBlockCollection::unpinBlocks() {
+    for (auto& block : blocks) {
+        block->unpin();
+    }
+}
+
 FactorizedTable::FactorizedTable(MemoryManager* memoryManager,
     std::unique_ptr<FactorizedTableSchema> tableSchema)
     : memoryManager{memoryManager}, tableSchema{std::move(tableSchema)}, numTuples{0} {
@@ -225,6 +237,18 @@ void FactorizedTable::merge(FactorizedTable& other) {
     numTuples += other.numTuples;
 }
 
+void FactorizedTable::pinBuffers() {
+    flatTupleBlockCollection->pinBlocks();
+    unflatTupleBlockCollection->pinBlocks();
+    inMemOverflowBuffer->pinBlocks();
+}
+
+void FactorizedTable::unpinBuffers() {
+    flatTupleBlockCollection->unpinBlocks();
+    unflatTupleBlockCollection->unpinBlocks();
+    inMemOverflowBuffer->unpinBlocks();
+}
+
 bool FactorizedTable::hasUnflatCol() const {
     std::vector<ft_col_idx_t> colIdxes(tableSchema->getNumColumns());
     iota(colIdxes.begin(), colIdxes.end(), 0);
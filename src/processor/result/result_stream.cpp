@@ -0,0 +1,51 @@
+#include "processor/result/result_stream.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+ResultStream::ResultStream(std::unique_ptr<PhysicalPlan> physicalPlan,
+    std::unique_ptr<Profiler> profiler, std::unique_ptr<ExecutionContext> executionContext)
+    : physicalPlan{std::move(physicalPlan)}, profiler{std::move(profiler)},
+      executionContext{std::move(executionContext)}, numTuplesPulled{0} {
+    resultCollector = ku_dynamic_cast<PhysicalOperator*, ResultCollector*>(
+        this->physicalPlan->lastOperator.get());
+    table = resultCollector->getResultFactorizedTable();
+    resultSet = std::make_unique<ResultSet>(resultCollector->getResultSetDescriptor(),
+        this->executionContext->clientContext->getMemoryManager());
+    resultCollector->initGlobalState(this->executionContext.get());
+    resultCollector->initLocalState(resultSet.get(), this->executionContext.get());
+}
+
+void ResultStream::pullNextChunk() {
+    table->clear();
+    pullTuples(MIN_NUM_TUPLES_PER_CHUNK);
+}
+
+void ResultStream::pullAllTuples() {
+    pullTuples(UINT64_MAX);
+}
+
+void ResultStream::pullTuples(uint64_t minNumTuples) {
+    uint64_t numTuples = 0;
+    while (!isExhausted() && numTuples < minNumTuples) {
+        if (resultCollector->collectNextTuples(*table, executionContext.get())) {
+            numTuples += resultCollector->getNumFlatTuplesCollected();
+        } else {
+            close();
+        }
+    }
+    numTuplesPulled += numTuples;
+}
+
+void ResultStream::close() {
+    resultSet.reset();
+    resultCollector = nullptr;
+    physicalPlan.reset();
+    executionContext.reset();
+    profiler.reset();
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -1,5 +1,6 @@
 #include "storage/buffer_manager/buffer_manager.h"
 
+#include <algorithm>
 #include <cstring>
 
 #include "common/constants.h"
@@ -70,7 +71,8 @@ BufferManager::BufferManager(uint64_t bufferPoolSize, uint64_t maxDBSize)
     verifySizeParams(bufferPoolSize, maxDBSize);
     vmRegions.resize(2);
     vmRegions[0] = std::make_unique<VMRegion>(PageSizeClass::PAGE_4KB, maxDBSize);
-    vmRegions[1] = std::make_unique<VMRegion>(PageSizeClass::PAGE_256KB, bufferPoolSize);
+    vmRegions[1] = std::make_unique<VMRegion>(PageSizeClass::PAGE_256KB,
+        std::max(bufferPoolSize, maxDBSize));
     evictionQueue = std::make_unique<EvictionQueue>();
 }
 
@@ -231,6 +233,54 @@ void BufferManager::unpin(BMFileHandle& fileHandle, page_idx_t pageIdx) {
     addToEvictionQueue(&fileHandle, pageIdx, pageState);
 }
 
+void BufferManager::prefetchPages(BMFileHandle& fileHandle, page_idx_t startPageIdx,
+    page_idx_t numPages) {
+    auto maxNumPagesToPrefetch =
+        bufferPoolSize.load() / fileHandle.getPageSize() / MAX_PREFETCH_BUFFER_POOL_FRACTION;
+    auto endPageIdx = std::min<uint64_t>({startPageIdx + numPages,
+        startPageIdx + maxNumPagesToPrefetch, fileHandle.getNumPages()});
+    std::vector<page_idx_t> pagesToRead;
+    std::vector<FileReadRequest> requests;
+    for (auto pageIdx = startPageIdx; pageIdx < endPageIdx; pageIdx++) {
+        auto pageState = fileHandle.getPageState(pageIdx);
+        auto currStateAndVersion = pageState->getStateAndVersion();
+        if (PageState::getState(currStateAndVersion) != PageState::EVICTED ||
+            !pageState->tryLock(currStateAndVersion)) {
+            continue;
+        }
+        if (!claimAFrame(fileHandle, pageIdx, PageReadPolicy::DONT_READ_PAGE)) {
+            pageState->resetToEvicted();
+            break;
+        }
+        // Frames of the pages in a page group are contiguous, so consecutive pages within a group
+        // are read with a single large read.
+        if (!pagesToRead.empty() && pagesToRead.back() == pageIdx - 1 &&
+            (pageIdx & StorageConstants::PAGE_IDX_IN_GROUP_MASK) != 0) {
+            requests.back().numBytes += fileHandle.getPageSize();
+        } else {
+            requests.push_back({getFrame(fileHandle, pageIdx), fileHandle.getPageSize(),
+                pageIdx * fileHandle.getPageSize()});
+        }
+        pagesToRead.push_back(pageIdx);
+    }
+    if (requests.empty()) {
+        return;
+    }
+    try {
+        fileHandle.getFileInfo()->readFromFileBatch(requests);
+    } catch (std::exception&) {
+        for (auto pageIdx : pagesToRead) {
+            releaseFrameForPage(fileHandle, pageIdx);
+            freeUsedMemory(fileHandle.getPageSize());
+            fileHandle.getPageState(pageIdx)->resetToEvicted();
+        }
+        throw;
+    }
+    for (auto pageIdx : pagesToRead) {
+        unpin(fileHandle, pageIdx);
+    }
+}
+
 // This function tries to load the given page into a frame. Due to our design of mmap, each page is
 // uniquely mapped to a frame. Thus, claiming a frame is equivalent to ensuring enough physical
 // memory is available.
@@ -332,9 +382,17 @@ void BufferManager::removeFilePagesFromFrames(BMFileHandle& fileHandle) {
     }
 }
 
-void BufferManager::flushAllDirtyPagesInFrames(BMFileHandle& fileHandle) {
+void BufferManager::writeBackDirtyPages(BMFileHandle& fileHandle) {
     for (auto pageIdx = 0u; pageIdx < fileHandle.getNumPages(); ++pageIdx) {
+        // Evicted pages are never dirty, as eviction writes them back.
+        auto pageState = fileHandle.getPageState(pageIdx);
+        if (!pageState->isDirty()) {
+            continue;
+        }
+        pin(fileHandle, pageIdx);
         flushIfDirtyWithoutLock(fileHandle, pageIdx);
+        pageState->clearDirty();
+        unpin(fileHandle, pageIdx);
     }
 }
 
@@ -350,7 +408,8 @@ void BufferManager::removePageFromFrameIfNecessary(BMFileHandle& fileHandle, pag
     if (pageIdx >= fileHandle.getNumPages()) {
         return;
     }
-    removePageFromFrame(fileHandle, pageIdx, false /* do not flush */);
+    // The frame may hold committed changes that are not written back to disk yet.
+    removePageFromFrame(fileHandle, pageIdx, true /* flush */);
 }
 
 // NOTE: We assume the page is not pinned (locked) here.
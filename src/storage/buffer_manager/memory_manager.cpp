@@ -2,6 +2,7 @@
 
 #include <cstring>
 
+#include "common/file_system/virtual_file_system.h"
 #include "storage/buffer_manager/buffer_manager.h"
 
 using namespace kuzu::common;
@@ -10,21 +11,52 @@ namespace kuzu {
 namespace storage {
 
 MemoryBuffer::MemoryBuffer(MemoryAllocator* allocator, page_idx_t pageIdx, uint8_t* buffer)
-    : buffer{buffer}, pageIdx{pageIdx}, allocator{allocator} {}
+    : buffer{buffer}, pageIdx{pageIdx}, allocator{allocator}, isPinned{true} {}
 
 MemoryBuffer::~MemoryBuffer() {
     if (buffer != nullptr) {
-        allocator->freeBlock(pageIdx);
+        allocator->freeBlock(pageIdx, isPinned);
     }
 }
 
-MemoryAllocator::MemoryAllocator(BufferManager* bm, VirtualFileSystem* vfs) : bm{bm} {
+void MemoryBuffer::unpin() {
+    if (!isPinned || !allocator->canSpill()) {
+        return;
+    }
+    allocator->unpinBlock(pageIdx);
+    isPinned = false;
+}
+
+void MemoryBuffer::pin() {
+    if (isPinned) {
+        return;
+    }
+    allocator->pinBlock(pageIdx);
+    isPinned = true;
+}
+
+MemoryAllocator::MemoryAllocator(BufferManager* bm, VirtualFileSystem* vfs,
+    std::string spillFilePath)
+    : bm{bm}, vfs{vfs}, spillFilePath{std::move(spillFilePath)} {
     pageSize = BufferPoolConstants::PAGE_256KB_SIZE;
-    fh = bm->getBMFileHandle("mm-256KB", FileHandle::O_IN_MEM_TEMP_FILE,
-        BMFileHandle::FileVersionedType::NON_VERSIONED_FILE, vfs, PAGE_256KB);
+    if (canSpill()) {
+        // Pages left by a previous run hold no live buffers.
+        vfs->removeFileIfExists(this->spillFilePath);
+        fh = bm->getBMFileHandle(this->spillFilePath,
+            FileHandle::O_PERSISTENT_FILE_CREATE_NOT_EXISTS | FileHandle::isLargePagedMask,
+            BMFileHandle::FileVersionedType::NON_VERSIONED_FILE, vfs, PAGE_256KB);
+    } else {
+        fh = bm->getBMFileHandle("mm-256KB", FileHandle::O_IN_MEM_TEMP_FILE,
+            BMFileHandle::FileVersionedType::NON_VERSIONED_FILE, vfs, PAGE_256KB);
+    }
 }
 
-MemoryAllocator::~MemoryAllocator() = default;
+MemoryAllocator::~MemoryAllocator() {
+    fh.reset();
+    if (canSpill()) {
+        vfs->removeFileIfExists(spillFilePath);
+    }
+}
 
 std::unique_ptr<MemoryBuffer> MemoryAllocator::allocateBuffer(bool initializeToZero) {
     std::unique_lock<std::mutex> lock(allocatorLock);
@@ -43,11 +75,26 @@ std::unique_ptr<MemoryBuffer> MemoryAllocator::allocateBuffer(bool initializeToZ
     return memoryBuffer;
 }
 
-void MemoryAllocator::freeBlock(page_idx_t pageIdx) {
+void MemoryAllocator::freeBlock(page_idx_t pageIdx, bool isPinned) {
     std::unique_lock<std::mutex> lock(allocatorLock);
-    bm->unpin(*fh, pageIdx);
+    // An unpinned page is already evictable, and is not read back when allocated again.
+    if (isPinned) {
+        bm->unpin(*fh, pageIdx);
+    }
     freePages.push(pageIdx);
 }
 
+void MemoryAllocator::unpinBlock(page_idx_t pageIdx) {
+    std::unique_lock<std::mutex> lock(allocatorLock);
+    // The page must be written to the spill file if it gets evicted.
+    fh->setLockedPageDirty(pageIdx);
+    bm->unpin(*fh, pageIdx);
+}
+
+void MemoryAllocator::pinBlock(page_idx_t pageIdx) {
+    std::unique_lock<std::mutex> lock(allocatorLock);
+    bm->pin(*fh, pageIdx, BufferManager::PageReadPolicy::READ_PAGE);
+}
+
 } // namespace storage
 } // namespace kuzu
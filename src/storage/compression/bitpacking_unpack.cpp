@@ -0,0 +1,268 @@
+#include "storage/compression/bitpacking_unpack.h"
+
+#include <algorithm>
+#include <type_traits>
+
+#include "common/assert.h"
+#include "fastpfor/bitpackinghelpers.h"
+#include "storage/compression/compression.h"
+#include "storage/compression/sign_extend.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define KUZU_X86_UNPACK_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace kuzu {
+namespace storage {
+
+static constexpr uint64_t CHUNK_SIZE = 32;
+
+template<typename T>
+void fastunpack(const uint8_t* in, T* out, uint32_t bitWidth) {
+    if constexpr (std::is_same_v<std::make_signed_t<T>, int32_t> ||
+                  std::is_same_v<std::make_signed_t<T>, int64_t>) {
+        FastPForLib::fastunpack((const uint32_t*)in, out, bitWidth);
+    } else if constexpr (std::is_same_v<std::make_signed_t<T>, int16_t>) {
+        FastPForLib::fastunpack((const uint16_t*)in, out, bitWidth);
+    } else {
+        static_assert(std::is_same_v<std::make_signed_t<T>, int8_t>);
+        FastPForLib::fastunpack((const uint8_t*)in, out, bitWidth);
+    }
+}
+
+template void fastunpack<uint8_t>(const uint8_t* in, uint8_t* out, uint32_t bitWidth);
+template void fastunpack<uint16_t>(const uint8_t* in, uint16_t* out, uint32_t bitWidth);
+template void fastunpack<uint32_t>(const uint8_t* in, uint32_t* out, uint32_t bitWidth);
+template void fastunpack<uint64_t>(const uint8_t* in, uint64_t* out, uint32_t bitWidth);
+
+template<typename U>
+static void unpackChunksScalar(const uint8_t* in, U* out, uint64_t numChunks, uint8_t bitWidth,
+    bool hasNegative, U offset) {
+    auto bytesPerChunk = CHUNK_SIZE * bitWidth / 8;
+    for (auto i = 0u; i < numChunks; i++) {
+        fastunpack(in, out, bitWidth);
+        if (hasNegative) {
+            SignExtend<std::make_signed_t<U>, U, CHUNK_SIZE>((uint8_t*)out, bitWidth);
+        }
+        if (offset != 0) {
+            for (auto j = 0u; j < CHUNK_SIZE; j++) {
+                out[j] += offset;
+            }
+        }
+        in += bytesPerChunk;
+        out += CHUNK_SIZE;
+    }
+}
+
+#ifdef KUZU_X86_UNPACK_KERNELS
+// The vectorized kernels gather, for each value, the loadSize bytes starting at the byte containing
+// its first bit, then shift and mask the value out of them. A value fits in the load if it doesn't
+// have more than loadSize * 8 - 7 bits.
+template<typename U>
+static constexpr uint8_t getMaxVectorizedBitWidth() {
+    return sizeof(U) * 8 - 7;
+}
+
+// Returns the number of leading chunks in which each value can be read with a loadSize-byte load
+// without reading past the end of the numChunks chunks.
+static uint64_t getNumVectorizableChunks(uint64_t numChunks, uint8_t bitWidth, uint64_t loadSize) {
+    auto numBytes = numChunks * CHUNK_SIZE * bitWidth / 8;
+    if (numBytes < loadSize) {
+        return 0;
+    }
+    auto lastLoadableBit = (numBytes - loadSize) * 8 + 7;
+    auto numLoadableValues = lastLoadableBit / bitWidth + 1;
+    return std::min(numChunks, numLoadableValues / CHUNK_SIZE);
+}
+
+__attribute__((target("avx2"))) static void unpackChunksAVX2(const uint8_t* in, uint64_t* out,
+    uint64_t numChunks, uint8_t bitWidth, bool hasNegative, uint64_t offset) {
+    const auto mask = _mm256_set1_epi64x((int64_t)((1ull << bitWidth) - 1));
+    // (value ^ signBit) - signBit sign extends the value, and is a no-op if signBit is 0
+    const auto signBit = _mm256_set1_epi64x(hasNegative ? (int64_t)(1ull << (bitWidth - 1)) : 0);
+    const auto offsetVector = _mm256_set1_epi64x((int64_t)offset);
+    const auto firstBitPositions = _mm256_setr_epi64x(0, bitWidth, 2 * bitWidth, 3 * bitWidth);
+    const auto step = _mm256_set1_epi64x(4 * bitWidth);
+    const auto bitInByteMask = _mm256_set1_epi64x(7);
+    for (auto i = 0u; i < numChunks; i++) {
+        auto bitPositions = firstBitPositions;
+        for (auto j = 0u; j < CHUNK_SIZE; j += 4) {
+            auto words = _mm256_i64gather_epi64((const long long*)in,
+                _mm256_srli_epi64(bitPositions, 3), 1 /*scale*/);
+            auto values = _mm256_and_si256(
+                _mm256_srlv_epi64(words, _mm256_and_si256(bitPositions, bitInByteMask)), mask);
+            values = _mm256_sub_epi64(_mm256_xor_si256(values, signBit), signBit);
+            values = _mm256_add_epi64(values, offsetVector);
+            _mm256_storeu_si256((__m256i*)(out + j), values);
+            bitPositions = _mm256_add_epi64(bitPositions, step);
+        }
+        in += CHUNK_SIZE * bitWidth / 8;
+        out += CHUNK_SIZE;
+    }
+}
+
+__attribute__((target("avx2"))) static void unpackChunksAVX2(const uint8_t* in, uint32_t* out,
+    uint64_t numChunks, uint8_t bitWidth, bool hasNegative, uint32_t offset) {
+    const auto mask = _mm256_set1_epi32((int32_t)((1u << bitWidth) - 1));
+    const auto signBit = _mm256_set1_epi32(hasNegative ? (int32_t)(1u << (bitWidth - 1)) : 0);
+    const auto offsetVector = _mm256_set1_epi32((int32_t)offset);
+    const auto firstBitPositions = _mm256_setr_epi32(0, bitWidth, 2 * bitWidth, 3 * bitWidth,
+        4 * bitWidth, 5 * bitWidth, 6 * bitWidth, 7 * bitWidth);
+    const auto step = _mm256_set1_epi32(8 * bitWidth);
+    const auto bitInByteMask = _mm256_set1_epi32(7);
+    for (auto i = 0u; i < numChunks; i++) {
+        auto bitPositions = firstBitPositions;
+        for (auto j = 0u; j < CHUNK_SIZE; j += 8) {
+            auto words = _mm256_i32gather_epi32((const int*)in,
+                _mm256_srli_epi32(bitPositions, 3), 1 /*scale*/);
+            auto values = _mm256_and_si256(
+                _mm256_srlv_epi32(words, _mm256_and_si256(bitPositions, bitInByteMask)), mask);
+            values = _mm256_sub_epi32(_mm256_xor_si256(values, signBit), signBit);
+            values = _mm256_add_epi32(values, offsetVector);
+            _mm256_storeu_si256((__m256i*)(out + j), values);
+            bitPositions = _mm256_add_epi32(bitPositions, step);
+        }
+        in += CHUNK_SIZE * bitWidth / 8;
+        out += CHUNK_SIZE;
+    }
+}
+
+// GCC 12 warns about the _mm512_undefined_epi32() used inside the AVX-512 intrinsics
+#ifndef __clang__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+__attribute__((target("avx512f"))) static void unpackChunksAVX512(const uint8_t* in,
+    uint64_t* out, uint64_t numChunks, uint8_t bitWidth, bool hasNegative, uint64_t offset) {
+    const auto mask = _mm512_set1_epi64((int64_t)((1ull << bitWidth) - 1));
+    const auto signBit = _mm512_set1_epi64(hasNegative ? (int64_t)(1ull << (bitWidth - 1)) : 0);
+    const auto offsetVector = _mm512_set1_epi64((int64_t)offset);
+    const auto firstBitPositions = _mm512_setr_epi64(0, bitWidth, 2 * bitWidth, 3 * bitWidth,
+        4 * bitWidth, 5 * bitWidth, 6 * bitWidth, 7 * bitWidth);
+    const auto step = _mm512_set1_epi64(8 * bitWidth);
+    const auto bitInByteMask = _mm512_set1_epi64(7);
+    for (auto i = 0u; i < numChunks; i++) {
+        auto bitPositions = firstBitPositions;
+        for (auto j = 0u; j < CHUNK_SIZE; j += 8) {
+            auto words =
+                _mm512_i64gather_epi64(_mm512_srli_epi64(bitPositions, 3), in, 1 /*scale*/);
+            auto values = _mm512_and_si512(
+                _mm512_srlv_epi64(words, _mm512_and_si512(bitPositions, bitInByteMask)), mask);
+            values = _mm512_sub_epi64(_mm512_xor_si512(values, signBit), signBit);
+            values = _mm512_add_epi64(values, offsetVector);
+            _mm512_storeu_si512(out + j, values);
+            bitPositions = _mm512_add_epi64(bitPositions, step);
+        }
+        in += CHUNK_SIZE * bitWidth / 8;
+        out += CHUNK_SIZE;
+    }
+}
+
+__attribute__((target("avx512f"))) static void unpackChunksAVX512(const uint8_t* in,
+    uint32_t* out, uint64_t numChunks, uint8_t bitWidth, bool hasNegative, uint32_t offset) {
+    const auto mask = _mm512_set1_epi32((int32_t)((1u << bitWidth) - 1));
+    const auto signBit = _mm512_set1_epi32(hasNegative ? (int32_t)(1u << (bitWidth - 1)) : 0);
+    const auto offsetVector = _mm512_set1_epi32((int32_t)offset);
+    const auto firstBitPositions = _mm512_setr_epi32(0, bitWidth, 2 * bitWidth, 3 * bitWidth,
+        4 * bitWidth, 5 * bitWidth, 6 * bitWidth, 7 * bitWidth, 8 * bitWidth, 9 * bitWidth,
+        10 * bitWidth, 11 * bitWidth, 12 * bitWidth, 13 * bitWidth, 14 * bitWidth, 15 * bitWidth);
+    const auto step = _mm512_set1_epi32(16 * bitWidth);
+    const auto bitInByteMask = _mm512_set1_epi32(7);
+    for (auto i = 0u; i < numChunks; i++) {
+        auto bitPositions = firstBitPositions;
+        for (auto j = 0u; j < CHUNK_SIZE; j += 16) {
+            auto words =
+                _mm512_i32gather_epi32(_mm512_srli_epi32(bitPositions, 3), in, 1 /*scale*/);
+            auto values = _mm512_and_si512(
+                _mm512_srlv_epi32(words, _mm512_and_si512(bitPositions, bitInByteMask)), mask);
+            values = _mm512_sub_epi32(_mm512_xor_si512(values, signBit), signBit);
+            values = _mm512_add_epi32(values, offsetVector);
+            _mm512_storeu_si512(out + j, values);
+            bitPositions = _mm512_add_epi32(bitPositions, step);
+        }
+        in += CHUNK_SIZE * bitWidth / 8;
+        out += CHUNK_SIZE;
+    }
+}
+#ifndef __clang__
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+bool isUnpackKernelSupported(UnpackKernel kernel) {
+    switch (kernel) {
+    case UnpackKernel::SCALAR:
+        return true;
+#ifdef KUZU_X86_UNPACK_KERNELS
+    case UnpackKernel::AVX2:
+        return __builtin_cpu_supports("avx2");
+    case UnpackKernel::AVX512:
+        return __builtin_cpu_supports("avx512f");
+#endif
+    default:
+        return false;
+    }
+}
+
+UnpackKernel getBestUnpackKernel() {
+    static const UnpackKernel bestKernel = []() {
+        for (auto kernel : {UnpackKernel::AVX512, UnpackKernel::AVX2}) {
+            if (isUnpackKernelSupported(kernel)) {
+                return kernel;
+            }
+        }
+        return UnpackKernel::SCALAR;
+    }();
+    return bestKernel;
+}
+
+template<typename T>
+void unpackChunks(const uint8_t* in, T* out, uint64_t numChunks, const BitpackHeader& header,
+    UnpackKernel kernel) {
+    KU_ASSERT(isUnpackKernelSupported(kernel));
+    // Sign extension and the offset give the same bits for signed and unsigned values
+    using U = std::make_unsigned_t<T>;
+    auto dst = reinterpret_cast<U*>(out);
+    auto offset = (U)header.offset;
+#ifdef KUZU_X86_UNPACK_KERNELS
+    if constexpr (sizeof(U) >= sizeof(uint32_t)) {
+        if (kernel != UnpackKernel::SCALAR && header.bitWidth > 0 &&
+            header.bitWidth <= getMaxVectorizedBitWidth<U>()) {
+            auto numVectorizedChunks =
+                getNumVectorizableChunks(numChunks, header.bitWidth, sizeof(U));
+            if (kernel == UnpackKernel::AVX512) {
+                unpackChunksAVX512(in, dst, numVectorizedChunks, header.bitWidth,
+                    header.hasNegative, offset);
+            } else {
+                unpackChunksAVX2(in, dst, numVectorizedChunks, header.bitWidth,
+                    header.hasNegative, offset);
+            }
+            in += numVectorizedChunks * CHUNK_SIZE * header.bitWidth / 8;
+            dst += numVectorizedChunks * CHUNK_SIZE;
+            numChunks -= numVectorizedChunks;
+        }
+    }
+#endif
+    unpackChunksScalar<U>(in, dst, numChunks, header.bitWidth, header.hasNegative, offset);
+}
+
+template void unpackChunks<int8_t>(const uint8_t* in, int8_t* out, uint64_t numChunks,
+    const BitpackHeader& header, UnpackKernel kernel);
+template void unpackChunks<int16_t>(const uint8_t* in, int16_t* out, uint64_t numChunks,
+    const BitpackHeader& header, UnpackKernel kernel);
+template void unpackChunks<int32_t>(const uint8_t* in, int32_t* out, uint64_t numChunks,
+    const BitpackHeader& header, UnpackKernel kernel);
+template void unpackChunks<int64_t>(const uint8_t* in, int64_t* out, uint64_t numChunks,
+    const BitpackHeader& header, UnpackKernel kernel);
+template void unpackChunks<uint8_t>(const uint8_t* in, uint8_t* out, uint64_t numChunks,
+    const BitpackHeader& header, UnpackKernel kernel);
+template void unpackChunks<uint16_t>(const uint8_t* in, uint16_t* out, uint64_t numChunks,
+    const BitpackHeader& header, UnpackKernel kernel);
+template void unpackChunks<uint32_t>(const uint8_t* in, uint32_t* out, uint64_t numChunks,
+    const BitpackHeader& header, UnpackKernel kernel);
+template void unpackChunks<uint64_t>(const uint8_t* in, uint64_t* out, uint64_t numChunks,
+    const BitpackHeader& header, UnpackKernel kernel);
+
+} // namespace storage
+} // namespace kuzu
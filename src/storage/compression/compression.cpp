@@ -1,7 +1,10 @@
 #include "storage/compression/compression.h"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include "common/exception/not_implemented.h"
 #include "common/exception/storage.h"
@@ -9,7 +12,7 @@
 #include "common/types/types.h"
 #include "common/vector/value_vector.h"
 #include "fastpfor/bitpackinghelpers.h"
-#include "storage/compression/sign_extend.h"
+#include "storage/compression/bitpacking_unpack.h"
 #include "storage/store/column.h"
 #include <bit>
 
@@ -52,7 +55,10 @@ bool CompressionMetadata::canAlwaysUpdateInPlace() const {
         return true;
     }
     case CompressionType::CONSTANT:
-    case CompressionType::INTEGER_BITPACKING: {
+    case CompressionType::INTEGER_BITPACKING:
+    case CompressionType::DELTA_BITPACKING:
+    case CompressionType::RUN_LENGTH:
+    case CompressionType::ALP: {
         return false;
     }
     default: {
@@ -138,6 +144,31 @@ bool CompressionMetadata::canUpdateInPlace(const uint8_t* data, uint32_t pos,
         }
         }
     }
+    // Changing a value would require re-encoding the values after it
+    case CompressionType::DELTA_BITPACKING:
+    case CompressionType::RUN_LENGTH: {
+        return false;
+    }
+    case CompressionType::ALP: {
+        switch (physicalType) {
+        case PhysicalTypeID::DOUBLE: {
+            auto value = reinterpret_cast<const double*>(data)[pos];
+            return FloatCompression<double>::canUpdateInPlace(value,
+                ALPHeader::readHeader(this->data));
+        }
+        case PhysicalTypeID::FLOAT: {
+            auto value = reinterpret_cast<const float*>(data)[pos];
+            return FloatCompression<float>::canUpdateInPlace(value,
+                ALPHeader::readHeader(this->data));
+        }
+        default: {
+            throw common::StorageException(
+                "Attempted to read from a column chunk which uses ALP but does not have a "
+                "supported floating point physical type: " +
+                PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
     default: {
         throw common::StorageException(
             "Unknown compression type with ID " + std::to_string((uint8_t)compression));
@@ -145,6 +176,37 @@ bool CompressionMetadata::canUpdateInPlace(const uint8_t* data, uint32_t pos,
     }
 }
 
+// Calls func with the DeltaBitpacking instance for the integer type used to store values of the
+// given physical type
+template<typename Func>
+static auto visitDeltaBitpacking(PhysicalTypeID physicalType, Func&& func) {
+    switch (physicalType) {
+    case PhysicalTypeID::INT64:
+        return func(DeltaBitpacking<int64_t>());
+    case PhysicalTypeID::INT32:
+        return func(DeltaBitpacking<int32_t>());
+    case PhysicalTypeID::INT16:
+        return func(DeltaBitpacking<int16_t>());
+    case PhysicalTypeID::INT8:
+        return func(DeltaBitpacking<int8_t>());
+    case PhysicalTypeID::INTERNAL_ID:
+    case PhysicalTypeID::LIST:
+    case PhysicalTypeID::UINT64:
+        return func(DeltaBitpacking<uint64_t>());
+    case PhysicalTypeID::STRING:
+    case PhysicalTypeID::UINT32:
+        return func(DeltaBitpacking<uint32_t>());
+    case PhysicalTypeID::UINT16:
+        return func(DeltaBitpacking<uint16_t>());
+    case PhysicalTypeID::UINT8:
+        return func(DeltaBitpacking<uint8_t>());
+    default: {
+        throw NotImplementedException("DELTA_BITPACKING is not implemented for type " +
+                                      PhysicalTypeUtils::physicalTypeToString(physicalType));
+    }
+    }
+}
+
 uint64_t CompressionMetadata::numValues(uint64_t pageSize, const LogicalType& dataType) const {
     switch (compression) {
     case CompressionType::CONSTANT: {
@@ -188,6 +250,28 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, const LogicalType& da
     case CompressionType::BOOLEAN_BITPACKING: {
         return BooleanBitpacking::numValues(pageSize);
     }
+    case CompressionType::DELTA_BITPACKING: {
+        return visitDeltaBitpacking(dataType.getPhysicalType(), [&]<typename T>(T) {
+            return T::numValues(pageSize, BitpackHeader::readHeader(data));
+        });
+    }
+    case CompressionType::RUN_LENGTH: {
+        return RunLengthEncoding::numValues(*this);
+    }
+    case CompressionType::ALP: {
+        switch (dataType.getPhysicalType()) {
+        case PhysicalTypeID::DOUBLE:
+            return FloatCompression<double>::numValues(pageSize, ALPHeader::readHeader(data));
+        case PhysicalTypeID::FLOAT:
+            return FloatCompression<float>::numValues(pageSize, ALPHeader::readHeader(data));
+        default: {
+            throw common::StorageException(
+                "Attempted to read from a column chunk which uses ALP but does not have a "
+                "supported floating point physical type: " +
+                PhysicalTypeUtils::physicalTypeToString(dataType.getPhysicalType()));
+        }
+        }
+    }
     default: {
         throw common::StorageException(
             "Unknown compression type with ID " + std::to_string((uint8_t)compression));
@@ -272,6 +356,18 @@ std::string CompressionMetadata::toString() const {
     case CompressionType::CONSTANT: {
         return "CONSTANT";
     }
+    case CompressionType::DELTA_BITPACKING: {
+        auto header = BitpackHeader::readHeader(data);
+        return "DELTA_BITPACKING[" + std::to_string(header.bitWidth) + "]";
+    }
+    case CompressionType::RUN_LENGTH: {
+        return "RUN_LENGTH[" + std::to_string(RunLengthEncoding::numValues(*this)) + "]";
+    }
+    case CompressionType::ALP: {
+        auto header = ALPHeader::readHeader(data);
+        return "ALP[" + std::to_string(header.exponent) + "," + std::to_string(header.bitWidth) +
+               "]";
+    }
     default: {
         KU_UNREACHABLE;
     }
@@ -363,19 +459,6 @@ bool IntegerBitpacking<T>::canUpdateInPlace(T value, const BitpackHeader& header
     return true;
 }
 
-template<typename T>
-void fastunpack(const uint8_t* in, T* out, uint32_t bitWidth) {
-    if constexpr (std::is_same_v<std::make_signed_t<T>, int32_t> ||
-                  std::is_same_v<std::make_signed_t<T>, int64_t>) {
-        FastPForLib::fastunpack((const uint32_t*)in, out, bitWidth);
-    } else if constexpr (std::is_same_v<std::make_signed_t<T>, int16_t>) {
-        FastPForLib::fastunpack((const uint16_t*)in, out, bitWidth);
-    } else {
-        static_assert(std::is_same_v<std::make_signed_t<T>, int8_t>);
-        FastPForLib::fastunpack((const uint8_t*)in, out, bitWidth);
-    }
-}
-
 template<typename T>
 void fastpack(const T* in, uint8_t* out, uint8_t bitWidth) {
     if constexpr (std::is_same_v<std::make_signed_t<T>, int32_t> ||
@@ -433,16 +516,8 @@ void IntegerBitpacking<T>::getValues(const uint8_t* chunkStart, uint8_t pos, uin
     // TODO(bmwinger): optimize as in setValueFromUncompressed
     KU_ASSERT(pos + numValuesToRead <= CHUNK_SIZE);
 
-    U chunk[CHUNK_SIZE];
-    fastunpack(chunkStart, chunk, header.bitWidth);
-    if (header.hasNegative) {
-        SignExtend<T, U, CHUNK_SIZE>((uint8_t*)chunk, header.bitWidth);
-    }
-    if (header.offset != 0) {
-        for (int i = pos; i < pos + numValuesToRead; i++) {
-            chunk[i] = (U)((T)chunk[i] + (T)header.offset);
-        }
-    }
+    T chunk[CHUNK_SIZE];
+    unpackChunks(chunkStart, chunk, 1 /*numChunks*/, header);
     memcpy(dst, &chunk[pos], sizeof(T) * numValuesToRead);
 }
 
@@ -531,19 +606,11 @@ void IntegerBitpacking<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t
         dstIndex += valuesInFirstChunk;
     }
 
-    // Use fastunpack to directly unpack the full-sized chunks
-    for (; dstIndex + CHUNK_SIZE <= dstOffset + numValues; dstIndex += CHUNK_SIZE) {
-        fastunpack(srcCursor, (U*)dstBuffer + dstIndex, header.bitWidth);
-        if (header.hasNegative) {
-            SignExtend<T, U, CHUNK_SIZE>(dstBuffer + dstIndex * sizeof(U), header.bitWidth);
-        }
-        if (header.offset != 0) {
-            for (auto i = 0u; i < CHUNK_SIZE; i++) {
-                ((T*)dstBuffer)[dstIndex + i] += (T)header.offset;
-            }
-        }
-        srcCursor += bytesPerChunk;
-    }
+    // Directly unpack the full-sized chunks into the destination
+    auto numFullChunks = (dstOffset + numValues - dstIndex) / CHUNK_SIZE;
+    unpackChunks(srcCursor, (T*)dstBuffer + dstIndex, numFullChunks, header);
+    srcCursor += numFullChunks * bytesPerChunk;
+    dstIndex += numFullChunks * CHUNK_SIZE;
     // Copy remaining values from within the last chunk.
     if (dstIndex < dstOffset + numValues) {
         getValues(srcCursor, 0, dstBuffer + dstIndex * sizeof(U), dstOffset + numValues - dstIndex,
@@ -560,6 +627,560 @@ template class IntegerBitpacking<uint16_t>;
 template class IntegerBitpacking<uint32_t>;
 template class IntegerBitpacking<uint64_t>;
 
+template<typename T>
+BitpackHeader DeltaBitpacking<T>::getHeader(const uint8_t* srcBuffer, uint64_t numValues) {
+    using S = std::make_signed_t<T>;
+    auto values = reinterpret_cast<const U*>(srcBuffer);
+    S minDelta = 0, maxDelta = 0;
+    for (auto i = 1u; i < numValues; i++) {
+        // Deltas use wrapping unsigned arithmetic, which is reversed when decompressing, so they
+        // can't overflow.
+        auto delta = (S)(U)(values[i] - values[i - 1]);
+        if (i == 1 || delta < minDelta) {
+            minDelta = delta;
+        }
+        if (i == 1 || delta > maxDelta) {
+            maxDelta = delta;
+        }
+    }
+    // A bit width of at least one keeps the number of values per page within the range of a
+    // PageCursor
+    auto bitWidth = std::max<int>(1, std::bit_width((U)((U)maxDelta - (U)minDelta)));
+    return BitpackHeader{static_cast<uint8_t>(bitWidth), false /*hasNegative*/,
+        (uint64_t)(U)minDelta};
+}
+
+template<typename T>
+uint64_t DeltaBitpacking<T>::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, uint64_t dstBufferSize,
+    const struct CompressionMetadata& metadata) const {
+    KU_ASSERT(metadata.compression == CompressionType::DELTA_BITPACKING);
+    auto header = BitpackHeader::readHeader(metadata.data);
+    auto bitWidth = header.bitWidth;
+    auto minDelta = (U)header.offset;
+    auto blockSize = getBlockSizeInBytes(bitWidth);
+    auto numValuesToCompress = std::min(numValuesRemaining, numValues(dstBufferSize, header));
+    auto values = reinterpret_cast<const U*>(srcBuffer);
+    U chunk[CHUNK_SIZE];
+    for (auto blockStart = 0ull; blockStart < numValuesToCompress; blockStart += BLOCK_SIZE) {
+        auto block = dstBuffer + blockStart / BLOCK_SIZE * blockSize;
+        memcpy(block, values + blockStart, sizeof(T));
+        auto blockEnd = std::min<uint64_t>(blockStart + BLOCK_SIZE, numValuesToCompress);
+        for (auto chunkStart = blockStart; chunkStart < blockEnd; chunkStart += CHUNK_SIZE) {
+            for (auto i = 0u; i < CHUNK_SIZE; i++) {
+                auto pos = chunkStart + i;
+                // The first value of the block is stored uncompressed, and the last chunk is
+                // padded with zeros
+                chunk[i] = (pos == blockStart || pos >= blockEnd) ?
+                               0 :
+                               (U)(values[pos] - values[pos - 1] - minDelta);
+            }
+            fastpack(chunk, block + sizeof(T) + (chunkStart - blockStart) * bitWidth / 8,
+                bitWidth);
+        }
+    }
+    srcBuffer += numValuesToCompress * sizeof(T);
+    auto numValuesInLastBlock = numValuesToCompress % BLOCK_SIZE;
+    auto compressedSize = numValuesToCompress / BLOCK_SIZE * blockSize;
+    if (numValuesInLastBlock > 0) {
+        // Round up to nearest byte
+        compressedSize += sizeof(T) + numValuesInLastBlock * bitWidth / 8 +
+                          (numValuesInLastBlock * bitWidth % 8 != 0);
+    }
+    return compressedSize;
+}
+
+template<typename T>
+void DeltaBitpacking<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) const {
+    auto header = BitpackHeader::readHeader(metadata.data);
+    auto bitWidth = header.bitWidth;
+    auto minDelta = (U)header.offset;
+    auto blockSize = getBlockSizeInBytes(bitWidth);
+    auto dst = reinterpret_cast<U*>(dstBuffer) + dstOffset;
+    auto endOffset = srcOffset + numValues;
+    U chunk[CHUNK_SIZE];
+    for (auto blockStart = srcOffset - srcOffset % BLOCK_SIZE; blockStart < endOffset;
+         blockStart += BLOCK_SIZE) {
+        auto block = srcBuffer + blockStart / BLOCK_SIZE * blockSize;
+        U value;
+        memcpy(&value, block, sizeof(T));
+        // Cancels out the minDelta added to the first value of the block below
+        value -= minDelta;
+        auto blockEnd = std::min<uint64_t>(blockStart + BLOCK_SIZE, endOffset);
+        for (auto chunkStart = blockStart; chunkStart < blockEnd; chunkStart += CHUNK_SIZE) {
+            fastunpack(block + sizeof(T) + (chunkStart - blockStart) * bitWidth / 8, chunk,
+                bitWidth);
+            if (chunkStart + CHUNK_SIZE <= srcOffset) {
+                // Only the sum of the deltas is needed for chunks before the values being read
+                U sum = 0;
+                for (auto i = 0u; i < CHUNK_SIZE; i++) {
+                    sum += chunk[i];
+                }
+                value += sum + (U)(minDelta * CHUNK_SIZE);
+                continue;
+            }
+            auto numValuesInChunk = std::min<uint64_t>(CHUNK_SIZE, blockEnd - chunkStart);
+            for (auto i = 0u; i < numValuesInChunk; i++) {
+                value += chunk[i] + minDelta;
+                auto pos = chunkStart + i;
+                if (pos >= srcOffset) {
+                    dst[pos - srcOffset] = value;
+                }
+            }
+        }
+    }
+}
+
+template class DeltaBitpacking<int8_t>;
+template class DeltaBitpacking<int16_t>;
+template class DeltaBitpacking<int32_t>;
+template class DeltaBitpacking<int64_t>;
+template class DeltaBitpacking<uint8_t>;
+template class DeltaBitpacking<uint16_t>;
+template class DeltaBitpacking<uint32_t>;
+template class DeltaBitpacking<uint64_t>;
+
+uint64_t RunLengthEncoding::numValues(const CompressionMetadata& metadata) {
+    uint32_t numValuesPerPage;
+    memcpy(&numValuesPerPage, metadata.data.data(), sizeof(numValuesPerPage));
+    return numValuesPerPage;
+}
+
+CompressionMetadata RunLengthEncoding::getCompressionMetadata(const uint8_t* srcBuffer,
+    uint64_t numValues) const {
+    // Positions at which a new run starts, excluding the first one
+    std::vector<uint32_t> runStarts;
+    for (auto i = 1u; i < numValues; i++) {
+        if (!isSameValue(srcBuffer, i, i - 1)) {
+            runStarts.push_back(i);
+        }
+    }
+    auto maxRunsPerPage = (BufferPoolConstants::PAGE_4KB_SIZE - sizeof(uint32_t)) /
+                          (sizeof(uint16_t) + numBytesPerValue);
+    // Each page starts a new run, so the number of runs within a page only grows with its size
+    uint32_t numValuesPerPage = MAX_VALUES_PER_PAGE;
+    for (; numValuesPerPage > maxRunsPerPage; numValuesPerPage /= 2) {
+        auto fits = true;
+        auto runIdx = 0u;
+        for (auto pageStart = 0u; pageStart < numValues && fits; pageStart += numValuesPerPage) {
+            auto pageEnd = pageStart + numValuesPerPage;
+            auto numRuns = 1u;
+            for (; runIdx < runStarts.size() && runStarts[runIdx] < pageEnd; runIdx++) {
+                if (runStarts[runIdx] > pageStart) {
+                    numRuns++;
+                }
+            }
+            fits = numRuns <= maxRunsPerPage;
+        }
+        if (fits) {
+            break;
+        }
+    }
+    std::array<uint8_t, CompressionMetadata::DATA_SIZE> data{};
+    memcpy(data.data(), &numValuesPerPage, sizeof(numValuesPerPage));
+    return CompressionMetadata(CompressionType::RUN_LENGTH, data);
+}
+
+uint64_t RunLengthEncoding::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, uint64_t dstBufferSize,
+    const struct CompressionMetadata& metadata) const {
+    KU_ASSERT(metadata.compression == CompressionType::RUN_LENGTH);
+    auto numValuesToCompress = std::min(numValuesRemaining, numValues(metadata));
+    uint32_t numRuns = numValuesToCompress > 0;
+    for (auto i = 1u; i < numValuesToCompress; i++) {
+        numRuns += !isSameValue(srcBuffer, i, i - 1);
+    }
+    auto compressedSize = sizeof(uint32_t) + numRuns * (sizeof(uint16_t) + numBytesPerValue);
+    KU_ASSERT(compressedSize <= dstBufferSize);
+    (void)dstBufferSize; // Avoid unused parameter warnings during release build.
+    memcpy(dstBuffer, &numRuns, sizeof(numRuns));
+    auto runEnds = reinterpret_cast<uint16_t*>(dstBuffer + sizeof(uint32_t));
+    auto runValues = dstBuffer + sizeof(uint32_t) + numRuns * sizeof(uint16_t);
+    if (numValuesToCompress > 0) {
+        auto runIdx = 0u;
+        memcpy(runValues, srcBuffer, numBytesPerValue);
+        for (auto i = 1u; i < numValuesToCompress; i++) {
+            if (!isSameValue(srcBuffer, i, i - 1)) {
+                runEnds[runIdx++] = i;
+                memcpy(runValues + runIdx * numBytesPerValue, srcBuffer + i * numBytesPerValue,
+                    numBytesPerValue);
+            }
+        }
+        runEnds[runIdx] = numValuesToCompress;
+    }
+    srcBuffer += numValuesToCompress * numBytesPerValue;
+    return compressedSize;
+}
+
+void RunLengthEncoding::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& /*metadata*/) const {
+    uint32_t numRuns;
+    memcpy(&numRuns, srcBuffer, sizeof(numRuns));
+    auto runEnds = reinterpret_cast<const uint16_t*>(srcBuffer + sizeof(uint32_t));
+    auto runValues = srcBuffer + sizeof(uint32_t) + numRuns * sizeof(uint16_t);
+    auto runIdx = std::upper_bound(runEnds, runEnds + numRuns, srcOffset) - runEnds;
+    auto dst = dstBuffer + dstOffset * numBytesPerValue;
+    for (auto pos = srcOffset; pos < srcOffset + numValues; pos++, dst += numBytesPerValue) {
+        if (runIdx < numRuns && pos >= runEnds[runIdx]) {
+            runIdx++;
+        }
+        // Positions past the last run have never been written (e.g. they are null)
+        if (runIdx < numRuns) {
+            memcpy(dst, runValues + runIdx * numBytesPerValue, numBytesPerValue);
+        } else {
+            memset(dst, 0, numBytesPerValue);
+        }
+    }
+}
+
+static uint64_t getNumPages(uint64_t numValues, uint64_t numValuesPerPage) {
+    if (numValuesPerPage == UINT64_MAX) {
+        return 0;
+    }
+    return numValues / numValuesPerPage + (numValues % numValuesPerPage != 0);
+}
+
+template<typename T>
+CompressionMetadata IntegerCompression<T>::getCompressionMetadata(const uint8_t* srcBuffer,
+    uint64_t numValues) const {
+    auto metadata = bitpacking.getCompressionMetadata(srcBuffer, numValues);
+    auto numValuesPerPage =
+        metadata.compression == CompressionType::UNCOMPRESSED ?
+            BufferPoolConstants::PAGE_4KB_SIZE / sizeof(T) :
+            IntegerBitpacking<T>::numValues(BufferPoolConstants::PAGE_4KB_SIZE,
+                BitpackHeader::readHeader(metadata.data));
+    auto maxNumPages = getNumPages(numValues, numValuesPerPage) / 2;
+    if (maxNumPages == 0) {
+        return metadata;
+    }
+    auto deltaMetadata = delta.getCompressionMetadata(srcBuffer, numValues);
+    auto deltaNumPages = getNumPages(numValues,
+        DeltaBitpacking<T>::numValues(BufferPoolConstants::PAGE_4KB_SIZE,
+            BitpackHeader::readHeader(deltaMetadata.data)));
+    if (deltaNumPages <= maxNumPages) {
+        metadata = deltaMetadata;
+        maxNumPages = deltaNumPages;
+    }
+    auto runLengthMetadata = runLength.getCompressionMetadata(srcBuffer, numValues);
+    if (getNumPages(numValues, RunLengthEncoding::numValues(runLengthMetadata)) <=
+        maxNumPages) {
+        metadata = runLengthMetadata;
+    }
+    return metadata;
+}
+
+template<typename T>
+const CompressionAlg& IntegerCompression<T>::getAlg(const CompressionMetadata& metadata) const {
+    switch (metadata.compression) {
+    case CompressionType::UNCOMPRESSED:
+        return uncompressed;
+    case CompressionType::INTEGER_BITPACKING:
+        return bitpacking;
+    case CompressionType::DELTA_BITPACKING:
+        return delta;
+    case CompressionType::RUN_LENGTH:
+        return runLength;
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+template class IntegerCompression<int8_t>;
+template class IntegerCompression<int16_t>;
+template class IntegerCompression<int32_t>;
+template class IntegerCompression<int64_t>;
+template class IntegerCompression<uint8_t>;
+template class IntegerCompression<uint16_t>;
+template class IntegerCompression<uint32_t>;
+template class IntegerCompression<uint64_t>;
+
+std::array<uint8_t, CompressionMetadata::DATA_SIZE> ALPHeader::getData() const {
+    std::array<uint8_t, CompressionMetadata::DATA_SIZE> data = {exponent, bitWidth,
+        exceptionCapacity};
+    memcpy(&data[3], &offset, OFFSET_SIZE);
+    return data;
+}
+
+ALPHeader ALPHeader::readHeader(const std::array<uint8_t, CompressionMetadata::DATA_SIZE>& data) {
+    ALPHeader header;
+    header.exponent = data[0];
+    header.bitWidth = data[1];
+    header.exceptionCapacity = data[2];
+    uint64_t offset = 0;
+    memcpy(&offset, &data[3], OFFSET_SIZE);
+    // Sign extend from 48 bits
+    header.offset = (int64_t)(offset << 16) >> 16;
+    return header;
+}
+
+static constexpr double POWERS_OF_TEN[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+    1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+// Encoded integers must be exactly representable as doubles for decoding to be exact
+static constexpr double MAX_ALP_ENCODED_VALUE = 9007199254740992.0; // 2^53
+static constexpr int64_t MAX_ALP_OFFSET = (int64_t)1 << (ALPHeader::OFFSET_SIZE * 8 - 1);
+
+static BitpackHeader getALPBitpackHeader(const ALPHeader& header) {
+    return BitpackHeader{header.bitWidth, false /*hasNegative*/, (uint64_t)header.offset};
+}
+
+template<typename T>
+inline T FloatCompression<T>::decode(int64_t value, uint8_t exponent) {
+    return (T)((double)value / POWERS_OF_TEN[exponent]);
+}
+
+template<typename T>
+bool FloatCompression<T>::encode(T value, uint8_t exponent, int64_t& result) {
+    auto scaled = (double)value * POWERS_OF_TEN[exponent];
+    // Also rejects NaN and infinity
+    if (!(std::abs(scaled) < MAX_ALP_ENCODED_VALUE)) {
+        return false;
+    }
+    result = (int64_t)std::nearbyint(scaled);
+    auto decoded = decode(result, exponent);
+    // Compare the bits so that e.g. -0.0 is not stored as 0.0
+    return memcmp(&decoded, &value, sizeof(T)) == 0;
+}
+
+template<typename T>
+bool FloatCompression<T>::canUpdateInPlace(T value, const ALPHeader& header) {
+    int64_t encoded;
+    if (!encode(value, header.exponent, encoded) || encoded < header.offset) {
+        return false;
+    }
+    return std::bit_width((uint64_t)(encoded - header.offset)) <= header.bitWidth;
+}
+
+template<typename T>
+uint64_t FloatCompression<T>::numValues(uint64_t dataSize, const ALPHeader& header) {
+    auto reservedSize =
+        sizeof(uint32_t) + header.exceptionCapacity * (sizeof(uint16_t) + sizeof(T));
+    if (dataSize <= reservedSize) {
+        return 0;
+    }
+    if (header.bitWidth == 0) {
+        return MAX_VALUES_PER_PAGE;
+    }
+    auto numValues = (dataSize - reservedSize) * 8 / header.bitWidth;
+    // Round down to a multiple of the bitpacking chunk size so that packing full chunks stays
+    // within the space before the exceptions
+    numValues -= numValues % 32;
+    return std::min(numValues, MAX_VALUES_PER_PAGE);
+}
+
+template<typename T>
+CompressionMetadata FloatCompression<T>::getCompressionMetadata(const uint8_t* srcBuffer,
+    uint64_t numValues) const {
+    auto values = reinterpret_cast<const T*>(srcBuffer);
+    // Pick the exponent giving the smallest encoding of a sample of the values. The sample is made
+    // of runs of consecutive values, since values at a fixed stride may share a pattern (e.g. all
+    // be whole numbers) which the rest of the values don't have.
+    static constexpr uint64_t NUM_SAMPLE_RUNS = 8;
+    static constexpr uint64_t SAMPLE_RUN_LENGTH = 32;
+    auto sampleStep = std::max<uint64_t>(SAMPLE_RUN_LENGTH, numValues / NUM_SAMPLE_RUNS);
+    uint8_t exponent = 0;
+    auto bestSize = UINT64_MAX;
+    for (uint8_t e = 0; e <= MAX_EXPONENT; e++) {
+        auto min = INT64_MAX, max = INT64_MIN;
+        uint64_t numSampled = 0, numExceptions = 0;
+        for (auto runStart = 0u; runStart < numValues; runStart += sampleStep) {
+            auto runEnd = std::min(runStart + SAMPLE_RUN_LENGTH, numValues);
+            for (auto i = runStart; i < runEnd; i++) {
+                int64_t encoded;
+                numSampled++;
+                if (encode(values[i], e, encoded)) {
+                    min = std::min(min, encoded);
+                    max = std::max(max, encoded);
+                } else {
+                    numExceptions++;
+                }
+            }
+        }
+        uint64_t bitWidth = min > max ? 0 : std::bit_width((uint64_t)(max - min));
+        auto size = numSampled * bitWidth + numExceptions * (sizeof(uint16_t) + sizeof(T)) * 8;
+        if (size < bestSize) {
+            bestSize = size;
+            exponent = e;
+        }
+    }
+    auto min = INT64_MAX, max = INT64_MIN;
+    std::vector<uint32_t> exceptions;
+    for (auto i = 0u; i < numValues; i++) {
+        int64_t encoded;
+        if (encode(values[i], exponent, encoded)) {
+            min = std::min(min, encoded);
+            max = std::max(max, encoded);
+        } else {
+            exceptions.push_back(i);
+        }
+    }
+    if (min > max || min < -MAX_ALP_OFFSET || min >= MAX_ALP_OFFSET) {
+        return CompressionMetadata();
+    }
+    ALPHeader header{exponent, static_cast<uint8_t>(std::bit_width((uint64_t)(max - min))),
+        0 /*exceptionCapacity*/, min};
+    auto numUncompressedPages =
+        getNumPages(numValues, BufferPoolConstants::PAGE_4KB_SIZE / sizeof(T));
+    // Reserving space for more exceptions leaves less space for other values, so the smallest
+    // capacity which fits the exceptions of every page is the best one.
+    for (auto capacity = 0u; capacity <= UINT8_MAX; capacity++) {
+        header.exceptionCapacity = capacity;
+        auto numValuesPerPage = FloatCompression<T>::numValues(BufferPoolConstants::PAGE_4KB_SIZE,
+            header);
+        if (numValuesPerPage == 0 ||
+            getNumPages(numValues, numValuesPerPage) >= numUncompressedPages) {
+            break;
+        }
+        auto fits = true;
+        auto numExceptionsInPage = 0u;
+        for (auto i = 0u; i < exceptions.size() && fits; i++) {
+            if (i > 0 && exceptions[i] / numValuesPerPage != exceptions[i - 1] / numValuesPerPage) {
+                numExceptionsInPage = 0;
+            }
+            fits = ++numExceptionsInPage <= capacity;
+        }
+        if (fits) {
+            return CompressionMetadata(CompressionType::ALP, header.getData());
+        }
+    }
+    return CompressionMetadata();
+}
+
+template<typename T>
+uint64_t FloatCompression<T>::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, uint64_t dstBufferSize,
+    const struct CompressionMetadata& metadata) const {
+    if (metadata.compression == CompressionType::UNCOMPRESSED) {
+        return Uncompressed(sizeof(T)).compressNextPage(srcBuffer, numValuesRemaining, dstBuffer,
+            dstBufferSize, metadata);
+    }
+    KU_ASSERT(metadata.compression == CompressionType::ALP);
+    KU_ASSERT(dstBufferSize == BufferPoolConstants::PAGE_4KB_SIZE);
+    auto header = ALPHeader::readHeader(metadata.data);
+    auto numValuesPerPage = numValues(dstBufferSize, header);
+    auto numValuesToCompress = std::min(numValuesRemaining, numValuesPerPage);
+    auto values = reinterpret_cast<const T*>(srcBuffer);
+    auto packedBuffer = dstBuffer + sizeof(uint32_t);
+    auto exceptionPositions =
+        reinterpret_cast<uint16_t*>(packedBuffer + numValuesPerPage * header.bitWidth / 8);
+    auto exceptionValues =
+        reinterpret_cast<uint8_t*>(exceptionPositions + header.exceptionCapacity);
+    auto compressedSize = exceptionValues + header.exceptionCapacity * sizeof(T) - dstBuffer;
+    // Unused exception slots and bitpacked chunks must not contain garbage from previous pages
+    memset(dstBuffer, 0, compressedSize);
+    std::vector<uint64_t> encodedValues(numValuesToCompress);
+    uint32_t numExceptions = 0;
+    for (auto i = 0u; i < numValuesToCompress; i++) {
+        int64_t encoded;
+        if (encode(values[i], header.exponent, encoded)) {
+            encodedValues[i] = encoded;
+        } else {
+            KU_ASSERT(numExceptions < header.exceptionCapacity);
+            exceptionPositions[numExceptions] = i;
+            memcpy(exceptionValues + numExceptions * sizeof(T), &values[i], sizeof(T));
+            numExceptions++;
+            // Packed as zero, the value is replaced by the exception when decompressing
+            encodedValues[i] = header.offset;
+        }
+    }
+    memcpy(dstBuffer, &numExceptions, sizeof(numExceptions));
+    auto encodedCursor = reinterpret_cast<const uint8_t*>(encodedValues.data());
+    IntegerBitpacking<uint64_t>().compressNextPage(encodedCursor, numValuesToCompress,
+        packedBuffer, reinterpret_cast<uint8_t*>(exceptionPositions) - packedBuffer,
+        CompressionMetadata(CompressionType::INTEGER_BITPACKING,
+            getALPBitpackHeader(header).getData()));
+    srcBuffer += numValuesToCompress * sizeof(T);
+    return compressedSize;
+}
+
+template<typename T>
+void FloatCompression<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) const {
+    if (metadata.compression == CompressionType::UNCOMPRESSED) {
+        return Uncompressed(sizeof(T)).decompressFromPage(srcBuffer, srcOffset, dstBuffer,
+            dstOffset, numValues, metadata);
+    }
+    auto header = ALPHeader::readHeader(metadata.data);
+    auto numValuesPerPage = FloatCompression<T>::numValues(BufferPoolConstants::PAGE_4KB_SIZE,
+        header);
+    auto packedBuffer = srcBuffer + sizeof(uint32_t);
+    auto bitpackMetadata = CompressionMetadata(CompressionType::INTEGER_BITPACKING,
+        getALPBitpackHeader(header).getData());
+    auto dst = reinterpret_cast<T*>(dstBuffer) + dstOffset;
+    // Unpack the integers in batches, then decode them in a tight loop which the compiler can
+    // vectorize
+    static constexpr uint64_t BATCH_SIZE = 1024;
+    int64_t encoded[BATCH_SIZE];
+    for (auto i = 0u; i < numValues; i += BATCH_SIZE) {
+        auto numValuesInBatch = std::min(BATCH_SIZE, numValues - i);
+        IntegerBitpacking<uint64_t>().decompressFromPage(packedBuffer, srcOffset + i,
+            reinterpret_cast<uint8_t*>(encoded), 0 /*dstOffset*/, numValuesInBatch,
+            bitpackMetadata);
+        for (auto j = 0u; j < numValuesInBatch; j++) {
+            dst[i + j] = decode(encoded[j], header.exponent);
+        }
+    }
+    uint32_t numExceptions;
+    memcpy(&numExceptions, srcBuffer, sizeof(numExceptions));
+    auto exceptionPositions =
+        reinterpret_cast<const uint16_t*>(packedBuffer + numValuesPerPage * header.bitWidth / 8);
+    auto exceptionValues =
+        reinterpret_cast<const uint8_t*>(exceptionPositions + header.exceptionCapacity);
+    auto exceptionIdx =
+        std::lower_bound(exceptionPositions, exceptionPositions + numExceptions, srcOffset) -
+        exceptionPositions;
+    for (; exceptionIdx < numExceptions && exceptionPositions[exceptionIdx] < srcOffset + numValues;
+         exceptionIdx++) {
+        memcpy(dst + exceptionPositions[exceptionIdx] - srcOffset,
+            exceptionValues + exceptionIdx * sizeof(T), sizeof(T));
+    }
+}
+
+template<typename T>
+void FloatCompression<T>::setValuesFromUncompressed(const uint8_t* srcBuffer, offset_t srcOffset,
+    uint8_t* dstBuffer, offset_t dstOffset, offset_t numValues,
+    const CompressionMetadata& metadata) const {
+    if (metadata.compression == CompressionType::UNCOMPRESSED) {
+        return Uncompressed(sizeof(T)).setValuesFromUncompressed(srcBuffer, srcOffset, dstBuffer,
+            dstOffset, numValues, metadata);
+    }
+    auto header = ALPHeader::readHeader(metadata.data);
+    auto numValuesPerPage = FloatCompression<T>::numValues(BufferPoolConstants::PAGE_4KB_SIZE,
+        header);
+    auto packedBuffer = dstBuffer + sizeof(uint32_t);
+    auto bitpackMetadata = CompressionMetadata(CompressionType::INTEGER_BITPACKING,
+        getALPBitpackHeader(header).getData());
+    uint32_t numExceptions;
+    memcpy(&numExceptions, dstBuffer, sizeof(numExceptions));
+    auto exceptionPositions =
+        reinterpret_cast<uint16_t*>(packedBuffer + numValuesPerPage * header.bitWidth / 8);
+    auto exceptionValues =
+        reinterpret_cast<uint8_t*>(exceptionPositions + header.exceptionCapacity);
+    for (auto i = 0u; i < numValues; i++) {
+        auto value = reinterpret_cast<const T*>(srcBuffer)[srcOffset + i];
+        auto pos = dstOffset + i;
+        auto exception =
+            std::lower_bound(exceptionPositions, exceptionPositions + numExceptions, pos);
+        if (exception != exceptionPositions + numExceptions && *exception == pos) {
+            memcpy(exceptionValues + (exception - exceptionPositions) * sizeof(T), &value,
+                sizeof(T));
+            continue;
+        }
+        KU_ASSERT(canUpdateInPlace(value, header));
+        int64_t encoded;
+        encode(value, header.exponent, encoded);
+        IntegerBitpacking<uint64_t>().setValuesFromUncompressed(
+            reinterpret_cast<const uint8_t*>(&encoded), 0 /*srcOffset*/, packedBuffer, pos,
+            1 /*numValues*/, bitpackMetadata);
+    }
+}
+
+template class FloatCompression<double>;
+template class FloatCompression<float>;
+
 void BooleanBitpacking::setValuesFromUncompressed(const uint8_t* srcBuffer, offset_t srcOffset,
     uint8_t* dstBuffer, offset_t dstOffset, offset_t numValues,
     const CompressionMetadata& /*metadata*/) const {
@@ -671,6 +1292,30 @@ void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, Page
     case CompressionType::BOOLEAN_BITPACKING:
         return booleanBitpacking.decompressFromPage(frame, pageCursor.elemPosInPage,
             resultVector->getData(), posInVector, numValuesToRead, metadata);
+    case CompressionType::DELTA_BITPACKING:
+        return visitDeltaBitpacking(physicalType, [&]<typename T>(T alg) {
+            alg.decompressFromPage(frame, pageCursor.elemPosInPage, resultVector->getData(),
+                posInVector, numValuesToRead, metadata);
+        });
+    case CompressionType::RUN_LENGTH:
+        return runLength.decompressFromPage(frame, pageCursor.elemPosInPage,
+            resultVector->getData(), posInVector, numValuesToRead, metadata);
+    case CompressionType::ALP: {
+        switch (physicalType) {
+        case PhysicalTypeID::DOUBLE: {
+            return FloatCompression<double>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::FLOAT: {
+            return FloatCompression<float>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        default: {
+            throw NotImplementedException("ALP is not implemented for type " +
+                                          PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
     default:
         KU_UNREACHABLE;
     }
@@ -733,6 +1378,30 @@ void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor&
         // Reading into ColumnChunks should be done without decompressing for booleans
         return booleanBitpacking.copyFromPage(frame, pageCursor.elemPosInPage, result,
             startPosInResult, numValuesToRead, metadata);
+    case CompressionType::DELTA_BITPACKING:
+        return visitDeltaBitpacking(physicalType, [&]<typename T>(T alg) {
+            alg.decompressFromPage(frame, pageCursor.elemPosInPage, result, startPosInResult,
+                numValuesToRead, metadata);
+        });
+    case CompressionType::RUN_LENGTH:
+        return runLength.decompressFromPage(frame, pageCursor.elemPosInPage, result,
+            startPosInResult, numValuesToRead, metadata);
+    case CompressionType::ALP: {
+        switch (physicalType) {
+        case PhysicalTypeID::DOUBLE: {
+            return FloatCompression<double>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::FLOAT: {
+            return FloatCompression<float>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        default: {
+            throw NotImplementedException("ALP is not implemented for type " +
+                                          PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
     default:
         KU_UNREACHABLE;
     }
@@ -794,6 +1463,26 @@ void WriteCompressedValuesToPage::operator()(uint8_t* frame, uint16_t posInFrame
     case CompressionType::BOOLEAN_BITPACKING:
         return booleanBitpacking.copyFromPage(data, dataOffset, frame, posInFrame, numValues,
             metadata);
+    case CompressionType::DELTA_BITPACKING:
+    case CompressionType::RUN_LENGTH:
+        // Never updated in-place (see CompressionMetadata::canUpdateInPlace)
+        KU_UNREACHABLE;
+    case CompressionType::ALP: {
+        switch (physicalType) {
+        case PhysicalTypeID::DOUBLE: {
+            return FloatCompression<double>().setValuesFromUncompressed(data, dataOffset, frame,
+                posInFrame, numValues, metadata);
+        }
+        case PhysicalTypeID::FLOAT: {
+            return FloatCompression<float>().setValuesFromUncompressed(data, dataOffset, frame,
+                posInFrame, numValues, metadata);
+        }
+        default: {
+            throw NotImplementedException("ALP is not implemented for type " +
+                                          PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
 
     default:
         KU_UNREACHABLE;
@@ -0,0 +1,160 @@
+#include "storage/stats/column_chunk_stats.h"
+
+#include <cmath>
+#include <optional>
+
+#include "common/type_utils.h"
+#include "storage/store/column_chunk.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+template<typename T>
+static T getValue(const StorageValue& value) {
+    if constexpr (std::is_floating_point_v<T>) {
+        return value.floatVal;
+    } else if constexpr (std::is_signed_v<T>) {
+        return value.signedInt;
+    } else {
+        return value.unsignedInt;
+    }
+}
+
+bool StorageValue::gt(const StorageValue& other, PhysicalTypeID physicalType) const {
+    bool result = false;
+    TypeUtils::visit(
+        physicalType,
+        [&]<typename T>(T)
+            requires(std::is_integral_v<T> || std::is_floating_point_v<T>)
+        { result = getValue<T>(*this) > getValue<T>(other); },
+        [](auto) { KU_UNREACHABLE; });
+    return result;
+}
+
+bool ColumnChunkStats::isSupported(PhysicalTypeID physicalType) {
+    switch (physicalType) {
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT:
+        return true;
+    default:
+        return false;
+    }
+}
+
+template<typename T>
+static bool isNaN(T value) {
+    if constexpr (std::is_floating_point_v<T>) {
+        return std::isnan(value);
+    } else {
+        return false;
+    }
+}
+
+ColumnChunkStats ColumnChunkStats::compute(const uint8_t* data, const NullColumnChunk* nullChunk,
+    uint64_t numValues, PhysicalTypeID physicalType) {
+    ColumnChunkStats stats;
+    if (!isSupported(physicalType)) {
+        return stats;
+    }
+    TypeUtils::visit(
+        physicalType,
+        [&]<typename T>(T)
+            requires(std::is_integral_v<T> || std::is_floating_point_v<T>)
+        {
+            auto values = reinterpret_cast<const T*>(data);
+            std::optional<T> min, max;
+            for (auto i = 0u; i < numValues; i++) {
+                if (nullChunk && nullChunk->isNull(i)) {
+                    continue;
+                }
+                // NaN is unordered, so a chunk containing it cannot be described by a range.
+                if (isNaN(values[i])) {
+                    return;
+                }
+                if (!min || values[i] < *min) {
+                    min = values[i];
+                }
+                if (!max || values[i] > *max) {
+                    max = values[i];
+                }
+            }
+            if (min) {
+                stats.min = StorageValue::fromValue(*min);
+                stats.max = StorageValue::fromValue(*max);
+                stats.hasStats = true;
+            }
+        },
+        [](auto) { KU_UNREACHABLE; });
+    return stats;
+}
+
+bool ColumnChunkStats::update(const uint8_t* data, offset_t srcOffset, uint64_t numValues,
+    PhysicalTypeID physicalType) {
+    if (!hasStats || !isSupported(physicalType)) {
+        return false;
+    }
+    bool changed = false;
+    TypeUtils::visit(
+        physicalType,
+        [&]<typename T>(T)
+            requires(std::is_integral_v<T> || std::is_floating_point_v<T>)
+        {
+            auto values = reinterpret_cast<const T*>(data);
+            for (auto i = 0u; i < numValues && hasStats; i++) {
+                auto value = values[srcOffset + i];
+                if (isNaN(value)) {
+                    hasStats = false;
+                    changed = true;
+                } else {
+                    changed |= update(StorageValue::fromValue(value), physicalType);
+                }
+            }
+        },
+        [](auto) { KU_UNREACHABLE; });
+    return changed;
+}
+
+bool ColumnChunkStats::update(StorageValue value, PhysicalTypeID physicalType) {
+    if (min.gt(value, physicalType)) {
+        min = value;
+        return true;
+    }
+    if (value.gt(max, physicalType)) {
+        max = value;
+        return true;
+    }
+    return false;
+}
+
+bool ColumnPredicate::canSkip(const ColumnChunkStats& stats, PhysicalTypeID physicalType) const {
+    if (!stats.hasStats) {
+        return false;
+    }
+    switch (comparisonType) {
+    case ExpressionType::EQUALS:
+        return value.gt(stats.max, physicalType) || stats.min.gt(value, physicalType);
+    case ExpressionType::GREATER_THAN:
+        return !stats.max.gt(value, physicalType);
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return value.gt(stats.max, physicalType);
+    case ExpressionType::LESS_THAN:
+        return !value.gt(stats.min, physicalType);
+    case ExpressionType::LESS_THAN_EQUALS:
+        return stats.min.gt(value, physicalType);
+    default:
+        return false;
+    }
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -213,5 +213,24 @@ void StorageManager::rollbackInMemory() {
     }
 }
 
+void StorageManager::writeBackDirtyPages() {
+    auto bm = memoryManager.getBufferManager();
+    bm->writeBackDirtyPages(*dataFH);
+    bm->writeBackDirtyPages(*metadataFH);
+    for (auto& [tableID, table] : tables) {
+        if (table->getTableType() != TableType::NODE) {
+            continue;
+        }
+        auto pkIndex = ku_dynamic_cast<Table*, NodeTable*>(table.get())->getPKIndex();
+        if (pkIndex == nullptr) {
+            continue;
+        }
+        bm->writeBackDirtyPages(*pkIndex->getFileHandle());
+        if (pkIndex->getOverflowFile() != nullptr) {
+            bm->writeBackDirtyPages(*pkIndex->getOverflowFile()->getBMFileHandle());
+        }
+    }
+}
+
 } // namespace storage
 } // namespace kuzu
@@ -226,20 +226,22 @@ void BaseDiskArrayInternal::checkpointOrRollbackInMemoryIfNecessaryNoLock(bool i
         headerForWriteTrx = header;
     }
     clearWALPageVersionAndRemovePageFromFrameIfNecessary(headerPageIdx);
+    // PIPs are read from disk, so their pages are removed from frames first, which writes back
+    // any change that was committed to the frames only.
     for (uint64_t pipIdxOfUpdatedPIP : pipUpdates.updatedPipIdxs) {
+        clearWALPageVersionAndRemovePageFromFrameIfNecessary(pips[pipIdxOfUpdatedPIP].pipPageIdx);
         // Note: This should not cause a memory leak because PIPWrapper is a struct. So we
         // should overwrite the previous PIPWrapper's memory.
         if (isCheckpoint) {
             pips[pipIdxOfUpdatedPIP] = PIPWrapper(fileHandle, pips[pipIdxOfUpdatedPIP].pipPageIdx);
         }
-        clearWALPageVersionAndRemovePageFromFrameIfNecessary(pips[pipIdxOfUpdatedPIP].pipPageIdx);
     }
 
     for (page_idx_t pipPageIdxOfNewPIP : pipUpdates.pipPageIdxsOfInsertedPIPs) {
+        clearWALPageVersionAndRemovePageFromFrameIfNecessary(pipPageIdxOfNewPIP);
         if (isCheckpoint) {
             pips.emplace_back(fileHandle, pipPageIdxOfNewPIP);
         }
-        clearWALPageVersionAndRemovePageFromFrameIfNecessary(pipPageIdxOfNewPIP);
         if (!isCheckpoint) {
             // These are newly inserted pages, so we can truncate the file handle.
             ((BMFileHandle&)this->fileHandle)
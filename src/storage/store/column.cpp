@@ -357,6 +357,8 @@ void Column::scanInternal(Transaction* transaction, ValueVector* nodeIDVector,
         StorageUtils::getNodeGroupIdxAndOffsetInChunk(startNodeOffset);
     auto cursor = getPageCursorForOffset(transaction->getType(), nodeGroupIdx, offsetInChunk);
     auto chunkMeta = metadataDA->get(nodeGroupIdx, transaction->getType());
+    readAhead(transaction, chunkMeta, offsetInChunk,
+        std::min(offsetInChunk + DEFAULT_VECTOR_CAPACITY, chunkMeta.numValues));
     if (nodeIDVector->state->selVector->isUnfiltered()) {
         scanUnfiltered(transaction, cursor, nodeIDVector->state->selVector->selectedSize,
             resultVector, chunkMeta);
@@ -446,6 +448,37 @@ void Column::lookupValue(transaction::Transaction* transaction, offset_t nodeOff
     });
 }
 
+void Column::readAhead(Transaction* transaction, const ColumnChunkMetadata& chunkMeta,
+    offset_t startOffsetInChunk, offset_t endOffsetInChunk) {
+    // Pages appended by a write transaction only exist in the WAL until checkpointing, so only
+    // read-only transactions can read the chunk's pages straight from the data file.
+    if (transaction->getType() != transaction::TransactionType::READ_ONLY ||
+        chunkMeta.numPages == 0 || startOffsetInChunk >= endOffsetInChunk) {
+        return;
+    }
+    auto numValuesPerPage =
+        chunkMeta.compMeta.numValues(BufferPoolConstants::PAGE_4KB_SIZE, dataType);
+    if (numValuesPerPage == 0) {
+        return;
+    }
+    // Load every window that the scan enters with this range, assuming the previous range ended
+    // right before startOffsetInChunk.
+    auto getWindowIdx = [&](offset_t offsetInChunk) {
+        return offsetInChunk / numValuesPerPage / READ_AHEAD_NUM_PAGES;
+    };
+    auto startWindowIdx = startOffsetInChunk == 0 ? 0 : getWindowIdx(startOffsetInChunk - 1) + 1;
+    auto endWindowIdx = getWindowIdx(endOffsetInChunk - 1);
+    for (auto windowIdx = startWindowIdx; windowIdx <= endWindowIdx; windowIdx++) {
+        auto startPageInChunk = windowIdx * READ_AHEAD_NUM_PAGES;
+        if (startPageInChunk >= chunkMeta.numPages) {
+            break;
+        }
+        auto numPages = std::min<uint64_t>(READ_AHEAD_NUM_PAGES,
+            chunkMeta.numPages - startPageInChunk);
+        bufferManager->prefetchPages(*dataFH, chunkMeta.pageIdx + startPageInChunk, numPages);
+    }
+}
+
 void Column::readFromPage(Transaction* transaction, page_idx_t pageIdx,
     const std::function<void(uint8_t*)>& func) {
     // For constant compression, call read on a nullptr since there is no data on disk and
@@ -493,13 +526,19 @@ void Column::write(node_group_idx_t nodeGroupIdx, offset_t offsetInChunk,
     ValueVector* vectorToWriteFrom, uint32_t posInVectorToWriteFrom) {
     bool isNull = vectorToWriteFrom->isNull(posInVectorToWriteFrom);
     auto chunkMeta = metadataDA->get(nodeGroupIdx, TransactionType::WRITE);
+    bool metadataChanged = false;
     if (!isNull) {
         writeValue(chunkMeta, nodeGroupIdx, offsetInChunk, vectorToWriteFrom,
             posInVectorToWriteFrom);
+        metadataChanged = chunkMeta.stats.update(vectorToWriteFrom->getData(),
+            posInVectorToWriteFrom, 1 /* numValues */, dataType.getPhysicalType());
     }
     if (offsetInChunk >= chunkMeta.numValues) {
         chunkMeta.numValues = offsetInChunk + 1;
         KU_ASSERT(sanityCheckForWrites(chunkMeta, dataType));
+        metadataChanged = true;
+    }
+    if (metadataChanged) {
         metadataDA->update(nodeGroupIdx, chunkMeta);
     }
 }
@@ -518,9 +557,15 @@ void Column::write(node_group_idx_t nodeGroupIdx, offset_t offsetInChunk, Column
     offset_t dataOffset, length_t numValues) {
     auto state = getReadState(TransactionType::WRITE, nodeGroupIdx);
     writeValues(state, offsetInChunk, data->getData(), dataOffset, numValues);
+    // Null values are also included in the stats here, which only makes them less tight.
+    bool metadataChanged = state.metadata.stats.update(data->getData(), dataOffset, numValues,
+        dataType.getPhysicalType());
     if (offsetInChunk + numValues > state.metadata.numValues) {
         state.metadata.numValues = offsetInChunk + numValues;
         KU_ASSERT(sanityCheckForWrites(state.metadata, dataType));
+        metadataChanged = true;
+    }
+    if (metadataChanged) {
         metadataDA->update(nodeGroupIdx, state.metadata);
     }
 }
@@ -551,6 +596,7 @@ offset_t Column::appendValues(node_group_idx_t nodeGroupIdx, const uint8_t* data
     auto newNumPages = dataFH->getNumPages();
     state.metadata.numValues += numValues;
     state.metadata.numPages += (newNumPages - numPages);
+    state.metadata.stats.update(data, 0 /* srcOffset */, numValues, dataType.getPhysicalType());
     metadataDA->update(nodeGroupIdx, state.metadata);
     return startOffset;
 }
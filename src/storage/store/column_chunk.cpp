@@ -114,31 +114,37 @@ static std::shared_ptr<CompressionAlg> getCompression(const LogicalType& dataTyp
     }
     switch (dataType.getPhysicalType()) {
     case PhysicalTypeID::INT64: {
-        return std::make_shared<IntegerBitpacking<int64_t>>();
+        return std::make_shared<IntegerCompression<int64_t>>();
     }
     case PhysicalTypeID::INT32: {
-        return std::make_shared<IntegerBitpacking<int32_t>>();
+        return std::make_shared<IntegerCompression<int32_t>>();
     }
     case PhysicalTypeID::INT16: {
-        return std::make_shared<IntegerBitpacking<int16_t>>();
+        return std::make_shared<IntegerCompression<int16_t>>();
     }
     case PhysicalTypeID::INT8: {
-        return std::make_shared<IntegerBitpacking<int8_t>>();
+        return std::make_shared<IntegerCompression<int8_t>>();
     }
     case PhysicalTypeID::INTERNAL_ID:
     case PhysicalTypeID::LIST:
     case PhysicalTypeID::UINT64: {
-        return std::make_shared<IntegerBitpacking<uint64_t>>();
+        return std::make_shared<IntegerCompression<uint64_t>>();
     }
     case PhysicalTypeID::STRING:
     case PhysicalTypeID::UINT32: {
-        return std::make_shared<IntegerBitpacking<uint32_t>>();
+        return std::make_shared<IntegerCompression<uint32_t>>();
     }
     case PhysicalTypeID::UINT16: {
-        return std::make_shared<IntegerBitpacking<uint16_t>>();
+        return std::make_shared<IntegerCompression<uint16_t>>();
     }
     case PhysicalTypeID::UINT8: {
-        return std::make_shared<IntegerBitpacking<uint8_t>>();
+        return std::make_shared<IntegerCompression<uint8_t>>();
+    }
+    case PhysicalTypeID::DOUBLE: {
+        return std::make_shared<FloatCompression<double>>();
+    }
+    case PhysicalTypeID::FLOAT: {
+        return std::make_shared<FloatCompression<float>>();
     }
     default: {
         return std::make_shared<Uncompressed>(dataType);
@@ -187,7 +193,9 @@ void ColumnChunk::initializeFunction() {
     case PhysicalTypeID::UINT32:
     case PhysicalTypeID::UINT16:
     case PhysicalTypeID::UINT8:
-    case PhysicalTypeID::INT128: {
+    case PhysicalTypeID::INT128:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT: {
         auto compression = getCompression(this->dataType, enableCompression);
         flushBufferFunction = CompressedFlushBuffer(compression, this->dataType);
         getMetadataFunction = GetCompressionMetadata(compression, this->dataType);
@@ -393,22 +401,31 @@ bool ColumnChunk::sanityCheck() {
 
 ColumnChunkMetadata ColumnChunk::getMetadataToFlush() const {
     KU_ASSERT(numValues <= capacity);
+    ColumnChunkMetadata metadata;
     if (enableCompression) {
         // Determine if we can make use of constant compression
         auto constantMetadata = ConstantCompression::analyze(*this);
         if (constantMetadata) {
-            return ColumnChunkMetadata(INVALID_PAGE_IDX, 0, numValues, *constantMetadata);
+            metadata = ColumnChunkMetadata(INVALID_PAGE_IDX, 0, numValues, *constantMetadata);
         }
     }
-    KU_ASSERT(bufferSize == getBufferSize(capacity));
-    return getMetadataFunction(buffer.get(), bufferSize, capacity, numValues);
+    if (!metadata.compMeta.isConstant()) {
+        KU_ASSERT(bufferSize == getBufferSize(capacity));
+        metadata = getMetadataFunction(buffer.get(), bufferSize, capacity, numValues);
+    }
+    metadata.stats = ColumnChunkStats::compute(buffer.get(), nullChunk.get(), numValues,
+        dataType.getPhysicalType());
+    return metadata;
 }
 
 ColumnChunkMetadata ColumnChunk::flushBuffer(BMFileHandle* dataFH, page_idx_t startPageIdx,
     const ColumnChunkMetadata& metadata) {
     if (!metadata.compMeta.isConstant()) {
         KU_ASSERT(bufferSize == getBufferSize(capacity));
-        return flushBufferFunction(buffer.get(), bufferSize, dataFH, startPageIdx, metadata);
+        auto flushedMetadata =
+            flushBufferFunction(buffer.get(), bufferSize, dataFH, startPageIdx, metadata);
+        flushedMetadata.stats = metadata.stats;
+        return flushedMetadata;
     }
     return metadata;
 }
@@ -46,6 +46,26 @@ void NodeTable::read(Transaction* transaction, TableReadState& readState) {
     }
 }
 
+bool NodeTable::canSkipNodeGroup(Transaction* transaction, node_group_idx_t nodeGroupIdx,
+    const std::vector<ColumnPredicate>& predicates) const {
+    // Local changes of the transaction are not reflected in the statistics.
+    if (transaction->isWriteTransaction() &&
+        transaction->getLocalStorage()->getLocalTable(tableID) != nullptr) {
+        return false;
+    }
+    for (auto& predicate : predicates) {
+        auto column = tableData->getColumn(predicate.columnID);
+        if (nodeGroupIdx >= column->getNumNodeGroups(transaction)) {
+            continue;
+        }
+        auto metadata = column->getMetadata(nodeGroupIdx, transaction->getType());
+        if (predicate.canSkip(metadata.stats, column->getDataType().getPhysicalType())) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void NodeTable::scan(Transaction* transaction, TableReadState& readState) {
     tableData->scan(transaction, *readState.dataReadState, readState.nodeIDVector,
         readState.outputVectors);
@@ -11,7 +11,11 @@ namespace storage {
 
 WAL::WAL(const std::string& directory, bool readOnly, BufferManager& bufferManager,
     VirtualFileSystem* vfs)
-    : directory{directory}, bufferManager{bufferManager}, isLastLoggedRecordCommit_{false} {
+    : directory{directory}, bufferManager{bufferManager}, isLastLoggedRecordCommit_{false},
+      numRecords{0}, numRecordsUpToLastCommit{0}, numRecordsCommittedInMemory{0},
+      headerPageIdxAfterRecordsCommittedInMemory{0}, numRecordsCommittedInMemoryInHeaderPage{0},
+      hasRecordsRequiringCheckpoint{false}, numCommitsLogged{0}, isSyncing{false},
+      numCommitsSynced{0} {
     fileHandle = bufferManager.getBMFileHandle(
         vfs->joinPath(directory, std::string(StorageConstants::WAL_FILE_SUFFIX)),
         readOnly ? FileHandle::O_PERSISTENT_FILE_READ_ONLY :
@@ -45,6 +49,35 @@ void WAL::logCommit(uint64_t transactionID) {
     flushAllPages();
     WALRecord walRecord = WALRecord::newCommitRecord(transactionID);
     addNewWALRecordNoLock(walRecord);
+    flushHeaderPages();
+    numCommitsLogged++;
+}
+
+void WAL::syncCommits(uint64_t numCommits) {
+    std::unique_lock lck{mtxForSyncing};
+    while (numCommitsSynced < numCommits) {
+        if (isSyncing) {
+            cvForSyncing.wait(lck);
+            continue;
+        }
+        // Everything logged before the sync starts becomes durable with it, including commits
+        // logged after the ones we wait for.
+        isSyncing = true;
+        auto numCommitsToSync = getNumCommitsLogged();
+        lck.unlock();
+        try {
+            fileHandle->getFileInfo()->syncFile();
+        } catch (...) {
+            lck.lock();
+            isSyncing = false;
+            cvForSyncing.notify_all();
+            throw;
+        }
+        lck.lock();
+        isSyncing = false;
+        numCommitsSynced = std::max(numCommitsSynced, numCommitsToSync);
+        cvForSyncing.notify_all();
+    }
 }
 
 // TODO(Guodong): Turn the boolean into enum, TableType.
@@ -109,23 +142,41 @@ void WAL::clearWAL() {
     updatedTables.clear();
 }
 
+void WAL::setRecordsCommittedInMemory() {
+    lock_t lck{mtx};
+    KU_ASSERT(isLastLoggedRecordCommit_ && !hasRecordsRequiringCheckpoint);
+    numRecordsCommittedInMemory = numRecords;
+    headerPageIdxAfterRecordsCommittedInMemory = currentHeaderPageIdx;
+    numRecordsCommittedInMemoryInHeaderPage = getNumRecordsInCurrentHeaderPage();
+    // The in-memory structures of the updated tables have been checkpointed already.
+    updatedTables.clear();
+}
+
 void WAL::flushAllPages() {
     if (!isEmptyWAL()) {
         flushHeaderPages();
-        bufferManager.flushAllDirtyPagesInFrames(*fileHandle);
+        // The WAL pages stay in the buffer manager across commits in memory, so they are marked
+        // clean to not be written again by the next commit.
+        bufferManager.writeBackDirtyPages(*fileHandle);
     }
 }
 
 void WAL::initCurrentPage() {
     currentHeaderPageIdx = 0;
     isLastLoggedRecordCommit_ = false;
+    numRecords = 0;
+    numRecordsUpToLastCommit = 0;
+    numRecordsCommittedInMemory = 0;
+    headerPageIdxAfterRecordsCommittedInMemory = 0;
+    numRecordsCommittedInMemoryInHeaderPage = 0;
+    hasRecordsRequiringCheckpoint = false;
     if (fileHandle->getNumPages() == 0) {
         fileHandle->addNewPage();
         resetCurrentHeaderPagePrefix();
     } else {
         // If the file existed, read the first page into the currentHeaderPageBuffer.
         fileHandle->readPage(currentHeaderPageBuffer.get(), 0);
-        setIsLastRecordCommit();
+        initRecordCounts();
     }
 }
 
@@ -145,10 +196,22 @@ void WAL::addNewWALRecordNoLock(WALRecord& walRecord) {
     }
     incrementNumRecordsInCurrentHeaderPage();
     walRecord.writeWALRecordToBytes(currentHeaderPageBuffer.get(), offsetInCurrentHeaderPage);
+    numRecords++;
+    switch (walRecord.recordType) {
+    case WALRecordType::COMMIT_RECORD: {
+        numRecordsUpToLastCommit = numRecords;
+    } break;
+    case WALRecordType::PAGE_UPDATE_OR_INSERT_RECORD:
+    case WALRecordType::TABLE_STATISTICS_RECORD: {
+    } break;
+    default: {
+        hasRecordsRequiringCheckpoint = true;
+    }
+    }
     isLastLoggedRecordCommit_ = (WALRecordType::COMMIT_RECORD == walRecord.recordType);
 }
 
-void WAL::setIsLastRecordCommit() {
+void WAL::initRecordCounts() {
     WALIterator walIterator(fileHandle, mtx);
     WALRecord walRecord;
     KU_ASSERT(walIterator.hasNextRecord());
@@ -158,20 +221,29 @@ void WAL::setIsLastRecordCommit() {
     }
     while (walIterator.hasNextRecord()) {
         walIterator.getNextRecord(walRecord);
+        numRecords++;
+        if (WALRecordType::COMMIT_RECORD == walRecord.recordType) {
+            numRecordsUpToLastCommit = numRecords;
+        }
     }
     if (WALRecordType::COMMIT_RECORD == walRecord.recordType) {
         isLastLoggedRecordCommit_ = true;
     }
 }
 
-WALIterator::WALIterator(std::shared_ptr<BMFileHandle> fileHandle, std::mutex& mtx)
+WALIterator::WALIterator(std::shared_ptr<BMFileHandle> fileHandle, std::mutex& mtx,
+    page_idx_t startHeaderPageIdx, uint64_t numRecordsToSkip)
     : BaseWALAndWALIterator{std::move(fileHandle)}, mtx{mtx} {
     resetCurrentHeaderPagePrefix();
+    numRecordsReadInCurrentHeaderPage = 0;
     if (this->fileHandle->getNumPages() > 0) {
-        this->fileHandle->readPage(currentHeaderPageBuffer.get(),
-            0 /* first header page is at pageIdx 0 */);
+        currentHeaderPageIdx = startHeaderPageIdx;
+        this->fileHandle->readPage(currentHeaderPageBuffer.get(), startHeaderPageIdx);
+        KU_ASSERT(numRecordsToSkip <= getNumRecordsInCurrentHeaderPage());
+        offsetInCurrentHeaderPage += numRecordsToSkip * sizeof(WALRecord);
+        numRecordsReadInCurrentHeaderPage = numRecordsToSkip;
+        readNextHeaderPageIfNecessary();
     }
-    numRecordsReadInCurrentHeaderPage = 0;
 }
 
 void WALIterator::getNextRecord(WALRecord& retVal) {
@@ -182,6 +254,10 @@ void WALIterator::getNextRecord(WALRecord& retVal) {
     WALRecord::constructWALRecordFromBytes(retVal, currentHeaderPageBuffer.get(),
         offsetInCurrentHeaderPage);
     numRecordsReadInCurrentHeaderPage++;
+    readNextHeaderPageIfNecessary();
+}
+
+void WALIterator::readNextHeaderPageIfNecessary() {
     if ((numRecordsReadInCurrentHeaderPage == getNumRecordsInCurrentHeaderPage()) &&
         (getNextHeaderPageOfCurrentHeaderPage() != UINT32_MAX)) {
         page_idx_t nextHeaderPageIdx = getNextHeaderPageOfCurrentHeaderPage();
@@ -1,5 +1,6 @@
 #include "storage/wal_replayer.h"
 
+#include <cstring>
 #include <unordered_map>
 
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
@@ -20,13 +21,15 @@ using namespace kuzu::transaction;
 namespace kuzu {
 namespace storage {
 
-// COMMIT_CHECKPOINT:   isCheckpoint = true,  isRecovering = false
-// ROLLBACK:            isCheckpoint = false, isRecovering = false
-// RECOVERY_CHECKPOINT: isCheckpoint = true,  isRecovering = true
+// COMMIT_CHECKPOINT:   isCheckpoint = true,  isRecovering = false, isInMemory = false
+// COMMIT_IN_MEMORY:    isCheckpoint = true,  isRecovering = false, isInMemory = true
+// ROLLBACK:            isCheckpoint = false, isRecovering = false, isInMemory = false
+// RECOVERY_CHECKPOINT: isCheckpoint = true,  isRecovering = true,  isInMemory = false
 WALReplayer::WALReplayer(WAL* wal, StorageManager* storageManager, BufferManager* bufferManager,
     Catalog* catalog, WALReplayMode replayMode, common::VirtualFileSystem* vfs)
     : isRecovering{replayMode == WALReplayMode::RECOVERY_CHECKPOINT},
-      isCheckpoint{replayMode != WALReplayMode::ROLLBACK}, storageManager{storageManager},
+      isCheckpoint{replayMode != WALReplayMode::ROLLBACK},
+      isInMemory{replayMode == WALReplayMode::COMMIT_IN_MEMORY}, storageManager{storageManager},
       bufferManager{bufferManager}, vfs{vfs}, wal{wal}, catalog{catalog} {
     init();
 }
@@ -44,10 +47,19 @@ void WALReplayer::replay() {
             "Cannot checkpointInMemory WAL because last logged record is not a commit record.");
     }
     if (!wal->isEmptyWAL()) {
-        auto walIterator = wal->getIterator();
+        // Records of transactions that were committed in memory are already reflected in the
+        // buffer manager, so only the records of the current write transaction are replayed.
+        // Recovery replays every committed transaction and ignores the records of a transaction
+        // that did not commit.
+        auto startRecordIdx = isRecovering ? 0 : wal->getNumRecordsCommittedInMemory();
+        auto endRecordIdx =
+            isRecovering ? wal->getNumRecordsUpToLastCommit() : wal->getNumRecords();
+        auto walIterator =
+            isRecovering ? wal->getIterator() : wal->getIteratorAfterRecordsCommittedInMemory();
         WALRecord walRecord;
         std::unordered_map<DBFileID, std::unique_ptr<FileInfo>> fileCache;
-        while (walIterator->hasNextRecord()) {
+        for (auto recordIdx = startRecordIdx;
+             recordIdx < endRecordIdx && walIterator->hasNextRecord(); recordIdx++) {
             walIterator->getNextRecord(walRecord);
             replayWALRecord(walRecord, fileCache);
         }
@@ -104,24 +116,22 @@ void WALReplayer::replayWALRecord(WALRecord& walRecord,
 void WALReplayer::replayPageUpdateOrInsertRecord(const WALRecord& walRecord,
     std::unordered_map<DBFileID, std::unique_ptr<FileInfo>>& fileCache) {
     // 1. As the first step we copy over the page on disk, regardless of if we are recovering
-    // (and checkpointing) or checkpointing while during regular execution.
+    // (and checkpointing) or checkpointing while during regular execution. Committing in memory
+    // leaves the page on disk to the next checkpoint.
     auto dbFileID = walRecord.pageInsertOrUpdateRecord.dbFileID;
-    auto entry = fileCache.find(dbFileID);
-    if (entry == fileCache.end()) {
-        fileCache.insert(std::make_pair(dbFileID,
-            StorageUtils::getFileInfoForReadWrite(wal->getDirectory(), dbFileID, vfs)));
-        entry = fileCache.find(dbFileID);
-    }
-    auto& fileInfoOfDBFile = entry->second;
     if (isCheckpoint) {
-        if (!wal->isLastLoggedRecordCommit()) {
-            // Nothing to undo.
-            return;
-        }
         walFileHandle->readPage(pageBuffer.get(), walRecord.pageInsertOrUpdateRecord.pageIdxInWAL);
-        fileInfoOfDBFile->writeFile(pageBuffer.get(), BufferPoolConstants::PAGE_4KB_SIZE,
-            walRecord.pageInsertOrUpdateRecord.pageIdxInOriginalFile *
-                BufferPoolConstants::PAGE_4KB_SIZE);
+        if (!isInMemory) {
+            auto entry = fileCache.find(dbFileID);
+            if (entry == fileCache.end()) {
+                fileCache.insert(std::make_pair(dbFileID,
+                    StorageUtils::getFileInfoForReadWrite(wal->getDirectory(), dbFileID, vfs)));
+                entry = fileCache.find(dbFileID);
+            }
+            entry->second->writeFile(pageBuffer.get(), BufferPoolConstants::PAGE_4KB_SIZE,
+                walRecord.pageInsertOrUpdateRecord.pageIdxInOriginalFile *
+                    BufferPoolConstants::PAGE_4KB_SIZE);
+        }
     }
     if (!isRecovering) {
         // 2: If we are not recovering, we do any in-memory checkpointing or rolling back work
@@ -134,6 +144,9 @@ void WALReplayer::replayPageUpdateOrInsertRecord(const WALRecord& walRecord,
 
 void WALReplayer::replayTableStatisticsRecord(const WALRecord& walRecord) {
     if (isCheckpoint) {
+        if (isRecoveringWithUncommittedRecords()) {
+            return;
+        }
         if (walRecord.tableStatisticsRecord.isNodeTable) {
             auto walFilePath = StorageUtils::getNodesStatisticsAndDeletedIDsFilePath(vfs,
                 wal->getDirectory(), common::FileVersionType::WAL_VERSION);
@@ -164,6 +177,9 @@ void WALReplayer::replayTableStatisticsRecord(const WALRecord& walRecord) {
 
 void WALReplayer::replayCatalogRecord() {
     if (isCheckpoint) {
+        if (isRecoveringWithUncommittedRecords()) {
+            return;
+        }
         auto walFile = StorageUtils::getCatalogFilePath(vfs, wal->getDirectory(),
             common::FileVersionType::WAL_VERSION);
         auto originalFile = StorageUtils::getCatalogFilePath(vfs, wal->getDirectory(),
@@ -220,10 +236,7 @@ void WALReplayer::replayCopyTableRecord(const WALRecord& walRecord) {
             }
         } else {
             // RECOVERY.
-            if (wal->isLastLoggedRecordCommit()) {
-                return;
-            }
-            // TODO(Guodong): Do nothing for now. Should remove metaDA and reclaim free pages.
+            // Nothing to do, the copied data of committed transactions is already in the files.
         }
     } else {
         // ROLLBACK.
@@ -254,10 +267,6 @@ void WALReplayer::replayDropTableRecord(const WALRecord& walRecord) {
             }
             }
         } else {
-            if (!wal->isLastLoggedRecordCommit()) {
-                // Nothing to undo.
-                return;
-            }
             auto catalogForRecovery = getCatalogForRecovery(FileVersionType::ORIGINAL);
             auto tableEntry =
                 catalogForRecovery->getTableCatalogEntry(&DUMMY_READ_TRANSACTION, tableID);
@@ -289,10 +298,6 @@ void WALReplayer::replayDropPropertyRecord(const WALRecord& walRecord) {
             storageManager->getTable(tableID)->dropColumn(tableEntry->getColumnID(propertyID));
             // TODO(Guodong): Do nothing for now. Should remove metaDA and reclaim free pages.
         } else {
-            if (!wal->isLastLoggedRecordCommit()) {
-                // Nothing to undo.
-                return;
-            }
             // TODO(Guodong): Do nothing for now. Should remove metaDA and reclaim free pages.
         }
     } else {
@@ -332,14 +337,22 @@ void WALReplayer::checkpointOrRollbackVersionedFileHandleAndBufferManager(
     const WALRecord& walRecord, const DBFileID& dbFileID) {
     BMFileHandle* fileHandle = getVersionedFileHandleIfWALVersionAndBMShouldBeCleared(dbFileID);
     if (fileHandle) {
-        fileHandle->clearWALPageIdxIfNecessary(
-            walRecord.pageInsertOrUpdateRecord.pageIdxInOriginalFile);
-        if (isCheckpoint) {
+        auto pageIdx = walRecord.pageInsertOrUpdateRecord.pageIdxInOriginalFile;
+        fileHandle->clearWALPageIdxIfNecessary(pageIdx);
+        if (isInMemory) {
+            // The frame holds the only up-to-date copy of the page until it is written back, so it
+            // is loaded if necessary and marked dirty.
+            auto frame = bufferManager->pin(*fileHandle, pageIdx,
+                BufferManager::PageReadPolicy::DONT_READ_PAGE);
+            memcpy(frame, pageBuffer.get(), BufferPoolConstants::PAGE_4KB_SIZE);
+            fileHandle->setLockedPageDirty(pageIdx);
+            bufferManager->unpin(*fileHandle, pageIdx);
+        } else if (isCheckpoint) {
             // Update the page in buffer manager if it is in a frame. Note that we assume
             // that the pageBuffer currently contains the contents of the WALVersion, so the
             // caller needs to make sure that this assumption holds.
             bufferManager->updateFrameIfPageIsInFrameWithoutLock(*fileHandle, pageBuffer.get(),
-                walRecord.pageInsertOrUpdateRecord.pageIdxInOriginalFile);
+                pageIdx);
         } else {
             truncateFileIfInsertion(fileHandle, walRecord.pageInsertOrUpdateRecord);
         }
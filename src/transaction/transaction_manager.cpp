@@ -11,19 +11,42 @@ namespace transaction {
 
 std::unique_ptr<Transaction> TransactionManager::beginWriteTransaction(
     main::ClientContext& clientContext) {
-    // We obtain the lock for starting new transactions. In case this cannot be obtained this
-    // ensures calls to other public functions is not restricted.
-    lock_t newTransactionLck{mtxForStartingNewTransactions};
-    lock_t publicFunctionLck{mtxForSerializingPublicFunctionCalls};
-    if (hasActiveWriteTransactionNoLock()) {
-        throw TransactionManagerException(
-            "Cannot start a new write transaction in the system. Only one write transaction at a "
-            "time is allowed in the system.");
+    auto deadline = std::chrono::steady_clock::now() +
+                    std::chrono::microseconds(waitTimeoutForWriteTransactionInMicros);
+    std::optional<uint64_t> ticket;
+    while (true) {
+        // A running checkpoint finishes before the next write transaction starts.
+        lock_t checkpointLck{mtxForCheckpointing};
+        // We obtain the lock for starting new transactions. In case this cannot be obtained this
+        // ensures calls to other public functions is not restricted.
+        lock_t newTransactionLck{mtxForStartingNewTransactions};
+        lock_t publicFunctionLck{mtxForSerializingPublicFunctionCalls};
+        if (canStartWriteTransactionNoLock(ticket)) {
+            if (ticket) {
+                waitingWriteTransactionTickets.pop_front();
+            }
+            auto transaction = std::make_unique<Transaction>(clientContext,
+                TransactionType::WRITE, ++lastTransactionID);
+            activeWriteTransactionID = lastTransactionID;
+            return transaction;
+        }
+        // The active write transaction needs to start new transactions and checkpoint when it
+        // commits, so we only keep the lock for public function calls while waiting.
+        checkpointLck.unlock();
+        newTransactionLck.unlock();
+        if (!ticket) {
+            ticket = nextWriteTransactionTicket++;
+            waitingWriteTransactionTickets.push_back(*ticket);
+        }
+        if (!cvForWaitingWriteTransactions.wait_until(publicFunctionLck, deadline,
+                [&]() { return canStartWriteTransactionNoLock(ticket); })) {
+            std::erase(waitingWriteTransactionTickets, *ticket);
+            cvForWaitingWriteTransactions.notify_all();
+            throw TransactionManagerException(
+                "Timeout waiting for the active write transaction to finish. Only one write "
+                "transaction at a time is allowed in the system.");
+        }
     }
-    auto transaction =
-        std::make_unique<Transaction>(clientContext, TransactionType::WRITE, ++lastTransactionID);
-    activeWriteTransactionID = lastTransactionID;
-    return transaction;
 }
 
 std::unique_ptr<Transaction> TransactionManager::beginReadOnlyTransaction(
@@ -87,6 +110,30 @@ void TransactionManager::allowReceivingNewTransactions() {
     mtxForStartingNewTransactions.unlock();
 }
 
+bool TransactionManager::tryStartCheckpoint() {
+    mtxForCheckpointing.lock();
+    lock_t lck{mtxForSerializingPublicFunctionCalls};
+    if (hasActiveWriteTransactionNoLock()) {
+        mtxForCheckpointing.unlock();
+        return false;
+    }
+    return true;
+}
+
+void TransactionManager::finishCheckpoint() {
+    mtxForCheckpointing.unlock();
+}
+
+bool TransactionManager::tryStopNewTransactionsIfNoActiveReadTransactions() {
+    mtxForStartingNewTransactions.lock();
+    lock_t lck{mtxForSerializingPublicFunctionCalls};
+    if (!activeReadOnlyTransactionIDs.empty()) {
+        mtxForStartingNewTransactions.unlock();
+        return false;
+    }
+    return true;
+}
+
 void TransactionManager::stopNewTransactionsAndWaitUntilAllReadTransactionsLeave() {
     mtxForStartingNewTransactions.lock();
     lock_t lck{mtxForSerializingPublicFunctionCalls};
@@ -137,4 +137,36 @@ TEST_F(ApiTest, Prepare) {
                       "N, MANY_MANY);MATCH (a:N)-[:E]->(b:N) WHERE a.ID = 0 return b.ID;");
     ASSERT_EQ(result->getErrorMessage(),
         "Connection Exception: We do not support prepare multiple statements.");
-}
\ No newline at end of file
+}
+TEST_F(ApiTest, StreamResults) {
+    ASSERT_TRUE(conn->query("CALL stream_results=true")->isSuccess());
+    auto result = conn->query("UNWIND RANGE(1, 5000) AS x RETURN x");
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_THROW(result->resetIterator(), RuntimeException);
+    auto numTuples = 0u;
+    while (result->hasNext()) {
+        ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), ++numTuples);
+    }
+    ASSERT_EQ(numTuples, 5000);
+    ASSERT_EQ(result->getNumTuples(), 5000);
+    // Tuples that are not read before the next query are kept in the result.
+    result = conn->query("MATCH (a:person)-[:knows]->(b:person) RETURN a.ID, b.ID ORDER BY a.ID");
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 0);
+    ASSERT_TRUE(conn->query("BEGIN TRANSACTION")->isSuccess());
+    ASSERT_TRUE(conn->query("ROLLBACK")->isSuccess());
+    numTuples = 1;
+    while (result->hasNext()) {
+        result->getNext();
+        numTuples++;
+    }
+    ASSERT_EQ(numTuples, 14);
+    ASSERT_EQ(result->getNumTuples(), 14);
+    // Errors while pulling tuples fail the result.
+    result = conn->query("UNWIND RANGE(1, 5000) AS x RETURN to_uint8(x / 16)");
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_THROW(
+        while (result->hasNext()) { result->getNext(); }, Exception);
+    ASSERT_FALSE(result->isSuccess());
+    ApiTest::assertMatchPersonCountStar(conn.get());
+}
@@ -0,0 +1,78 @@
+#include <fcntl.h>
+
+#include <cstring>
+#include <filesystem>
+
+#include "common/file_system/virtual_file_system.h"
+#include "gtest/gtest.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "test_helper/test_helper.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+using namespace kuzu::testing;
+
+class BufferManagerTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        tempDir = TestHelper::appendKuzuRootPath(
+            TestHelper::TMP_TEST_DIR + TestHelper::getMillisecondsSuffix());
+        vfs = std::make_unique<VirtualFileSystem>();
+        vfs->createDir(tempDir);
+        // Fill each page with its own page index.
+        auto fileInfo = vfs->openFile(getDataFilePath(), O_CREAT | O_RDWR);
+        std::vector<uint8_t> page(BufferPoolConstants::PAGE_4KB_SIZE);
+        for (auto i = 0u; i < NUM_PAGES; i++) {
+            memset(page.data(), i, page.size());
+            fileInfo->writeFile(page.data(), page.size(), i * page.size());
+        }
+    }
+
+    void TearDown() override {
+        fileHandle.reset();
+        bm.reset();
+        std::filesystem::remove_all(tempDir);
+    }
+
+    std::string getDataFilePath() const { return vfs->joinPath(tempDir, "data.kz"); }
+
+    void openFileHandle(uint64_t bufferPoolSize) {
+        bm = std::make_unique<BufferManager>(bufferPoolSize,
+            BufferPoolConstants::DEFAULT_VM_REGION_MAX_SIZE);
+        fileHandle = bm->getBMFileHandle(getDataFilePath(),
+            FileHandle::O_PERSISTENT_FILE_NO_CREATE,
+            BMFileHandle::FileVersionedType::NON_VERSIONED_FILE, vfs.get());
+    }
+
+    void checkPages() {
+        for (auto i = 0u; i < NUM_PAGES; i++) {
+            bm->optimisticRead(*fileHandle, i, [&](uint8_t* frame) {
+                ASSERT_EQ(frame[0], (uint8_t)i);
+                ASSERT_EQ(frame[BufferPoolConstants::PAGE_4KB_SIZE - 1], (uint8_t)i);
+            });
+        }
+    }
+
+public:
+    static constexpr uint64_t NUM_PAGES = 200;
+    std::string tempDir;
+    std::unique_ptr<VirtualFileSystem> vfs;
+    std::unique_ptr<BufferManager> bm;
+    std::unique_ptr<BMFileHandle> fileHandle;
+};
+
+TEST_F(BufferManagerTest, PrefetchPages) {
+    openFileHandle(64 * NUM_PAGES * BufferPoolConstants::PAGE_4KB_SIZE);
+    // Pages already in frames are left alone.
+    bm->pin(*fileHandle, 3);
+    bm->unpin(*fileHandle, 3);
+    bm->prefetchPages(*fileHandle, 0, NUM_PAGES);
+    checkPages();
+}
+
+TEST_F(BufferManagerTest, PrefetchPagesIntoSmallBufferPool) {
+    openFileHandle(NUM_PAGES / 2 * BufferPoolConstants::PAGE_4KB_SIZE);
+    // Prefetching stops once it has claimed its share of the buffer pool.
+    bm->prefetchPages(*fileHandle, 0, NUM_PAGES);
+    checkPages();
+}
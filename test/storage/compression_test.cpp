@@ -1,4 +1,5 @@
 #include "gtest/gtest.h"
+#include "storage/compression/bitpacking_unpack.h"
 #include "storage/compression/compression.h"
 
 using namespace kuzu::common;
@@ -288,3 +289,337 @@ TEST(CompressionTests, OffsetIntegerPackingMultiPageSigned64) {
 
     integerPackingMultiPage(src);
 }
+
+template<typename T>
+void compressionMultiPage(const CompressionAlg& alg, const std::vector<T>& src,
+    const CompressionMetadata& metadata, const LogicalType& dataType) {
+    auto pageSize = 4096;
+    auto numValuesPerPage = metadata.numValues(pageSize, dataType);
+    int64_t numValuesRemaining = src.size();
+    const uint8_t* srcCursor = (uint8_t*)src.data();
+    auto pages = src.size() / numValuesPerPage + 1;
+    std::vector<std::vector<uint8_t>> dest(pages, std::vector<uint8_t>(pageSize));
+    size_t pageNum = 0;
+    while (numValuesRemaining > 0) {
+        ASSERT_LT(pageNum, pages);
+        auto compressedSize = alg.compressNextPage(srcCursor, numValuesRemaining,
+            dest[pageNum++].data(), pageSize, metadata);
+        ASSERT_LE(compressedSize, pageSize);
+        numValuesRemaining -= numValuesPerPage;
+    }
+    ASSERT_EQ(srcCursor, (uint8_t*)(src.data() + src.size()));
+    for (auto i = 0u; i < src.size(); i++) {
+        auto page = i / numValuesPerPage;
+        auto indexInPage = i % numValuesPerPage;
+        T value;
+        alg.decompressFromPage(dest[page].data(), indexInPage, (uint8_t*)&value, 0, 1 /*numValues*/,
+            metadata);
+        EXPECT_EQ(src[i], value);
+    }
+    std::vector<T> decompressed(src.size());
+    for (auto i = 0u; i < src.size(); i += numValuesPerPage) {
+        auto page = i / numValuesPerPage;
+        alg.decompressFromPage(dest[page].data(), 0, (uint8_t*)decompressed.data(), i,
+            std::min(numValuesPerPage, (uint64_t)src.size() - i), metadata);
+    }
+    ASSERT_EQ(decompressed, src);
+    // Decompress part of a page
+    auto numValuesInFirstPage = std::min(numValuesPerPage, (uint64_t)src.size());
+    decompressed.clear();
+    decompressed.resize(numValuesInFirstPage / 2);
+    alg.decompressFromPage(dest[0].data(), numValuesInFirstPage / 3, (uint8_t*)decompressed.data(),
+        0 /*dstOffset*/, numValuesInFirstPage / 2, metadata);
+    auto expected = std::vector(src.begin() + numValuesInFirstPage / 3,
+        src.begin() + numValuesInFirstPage / 3 + numValuesInFirstPage / 2);
+    EXPECT_EQ(decompressed, expected);
+}
+
+template<typename T>
+void deltaPackingMultiPage(const std::vector<T>& src, const LogicalType& dataType) {
+    auto alg = DeltaBitpacking<T>();
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    compressionMultiPage(alg, src, metadata, dataType);
+}
+
+TEST(CompressionTests, DeltaPackingMultiPageSorted64) {
+    int64_t numValues = 10000;
+    std::vector<int64_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = 1000000000 + i * 3 + i % 4;
+    }
+    deltaPackingMultiPage(src, LogicalType(LogicalTypeID::INT64));
+    auto header = DeltaBitpacking<int64_t>::getHeader((uint8_t*)src.data(), src.size());
+    EXPECT_EQ(header.bitWidth, 3);
+}
+
+TEST(CompressionTests, DeltaPackingMultiPageConstantStrideUnsigned64) {
+    int64_t numValues = 100000;
+    std::vector<uint64_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = i * 17;
+    }
+    deltaPackingMultiPage(src, LogicalType(LogicalTypeID::UINT64));
+    auto header = DeltaBitpacking<uint64_t>::getHeader((uint8_t*)src.data(), src.size());
+    EXPECT_EQ(header.bitWidth, 1);
+}
+
+TEST(CompressionTests, DeltaPackingMultiPageNegative32) {
+    int64_t numValues = 10000;
+    std::vector<int32_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = -i * 5 + i % 7;
+    }
+    deltaPackingMultiPage(src, LogicalType(LogicalTypeID::INT32));
+}
+
+TEST(CompressionTests, DeltaPackingMultiPageWrapping16) {
+    int64_t numValues = 10000;
+    std::vector<int16_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = i % 2 == 0 ? INT16_MIN : INT16_MAX;
+    }
+    deltaPackingMultiPage(src, LogicalType(LogicalTypeID::INT16));
+}
+
+TEST(CompressionTests, DeltaPackingMultiPageUnsigned8) {
+    int64_t numValues = 10000;
+    std::vector<uint8_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = i;
+    }
+    deltaPackingMultiPage(src, LogicalType(LogicalTypeID::UINT8));
+}
+
+template<typename T>
+void runLengthMultiPage(const std::vector<T>& src, const LogicalType& dataType) {
+    auto alg = RunLengthEncoding(dataType);
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    compressionMultiPage(alg, src, metadata, dataType);
+}
+
+TEST(CompressionTests, RunLengthMultiPageLongRuns64) {
+    int64_t numValues = 100000;
+    std::vector<int64_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = i / 1000 - 30;
+    }
+    runLengthMultiPage(src, LogicalType(LogicalTypeID::INT64));
+}
+
+TEST(CompressionTests, RunLengthMultiPageShortRuns32) {
+    int64_t numValues = 10000;
+    std::vector<uint32_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = i / 3;
+    }
+    runLengthMultiPage(src, LogicalType(LogicalTypeID::UINT32));
+}
+
+TEST(CompressionTests, RunLengthMultiPageVaryingRuns16) {
+    int64_t numValues = 100000;
+    std::vector<int16_t> src(numValues);
+    // Runs are long at the start and then become short, so the number of values per page has to
+    // be chosen for the short runs
+    for (int i = 0; i < numValues; i++) {
+        src[i] = i < 50000 ? i / 5000 : i / 2;
+    }
+    runLengthMultiPage(src, LogicalType(LogicalTypeID::INT16));
+}
+
+TEST(CompressionTests, IntegerCompressionChoosesAlgorithm) {
+    int64_t numValues = 100000;
+    std::vector<int64_t> sorted(numValues), runs(numValues), random(numValues);
+    uint64_t state = 1;
+    for (int i = 0; i < numValues; i++) {
+        sorted[i] = 1000000 + i * 2;
+        runs[i] = i / 10000;
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        random[i] = state >> 40;
+    }
+    auto alg = IntegerCompression<int64_t>();
+    auto sortedMetadata = alg.getCompressionMetadata((uint8_t*)sorted.data(), sorted.size());
+    EXPECT_EQ(sortedMetadata.compression, CompressionType::DELTA_BITPACKING);
+    EXPECT_FALSE(sortedMetadata.canAlwaysUpdateInPlace());
+    auto runsMetadata = alg.getCompressionMetadata((uint8_t*)runs.data(), runs.size());
+    EXPECT_EQ(runsMetadata.compression, CompressionType::RUN_LENGTH);
+    EXPECT_FALSE(
+        runsMetadata.canUpdateInPlace((uint8_t*)runs.data(), 0, PhysicalTypeID::INT64));
+    auto randomMetadata = alg.getCompressionMetadata((uint8_t*)random.data(), random.size());
+    EXPECT_EQ(randomMetadata.compression, CompressionType::INTEGER_BITPACKING);
+
+    auto dataType = LogicalType(LogicalTypeID::INT64);
+    compressionMultiPage(alg, sorted, sortedMetadata, dataType);
+    compressionMultiPage(alg, runs, runsMetadata, dataType);
+    compressionMultiPage(alg, random, randomMetadata, dataType);
+}
+
+template<typename T>
+void floatCompressionMultiPage(const std::vector<T>& src, const LogicalType& dataType) {
+    auto alg = FloatCompression<T>();
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    EXPECT_EQ(metadata.compression, CompressionType::ALP);
+    compressionMultiPage(alg, src, metadata, dataType);
+}
+
+TEST(CompressionTests, FloatCompressionMultiPageDecimals) {
+    int64_t numValues = 100000;
+    std::vector<double> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = (i * 7 % 100000 - 2000) / 100.0;
+    }
+    floatCompressionMultiPage(src, LogicalType(LogicalTypeID::DOUBLE));
+    auto metadata = FloatCompression<double>().getCompressionMetadata((uint8_t*)src.data(),
+        src.size());
+    auto header = ALPHeader::readHeader(metadata.data);
+    EXPECT_EQ(header.exponent, 2);
+    EXPECT_EQ(header.bitWidth, 17);
+    EXPECT_EQ(header.exceptionCapacity, 0);
+    EXPECT_EQ(header.offset, -2000);
+}
+
+TEST(CompressionTests, FloatCompressionMultiPageFloat) {
+    int64_t numValues = 100000;
+    std::vector<float> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = (float)(i % 1000) / 10;
+    }
+    floatCompressionMultiPage(src, LogicalType(LogicalTypeID::FLOAT));
+}
+
+TEST(CompressionTests, FloatCompressionExceptions) {
+    int64_t numValues = 100000;
+    std::vector<double> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = (i % 5000) / 10.0;
+    }
+    std::vector<double> exceptions = {std::numeric_limits<double>::quiet_NaN(), -0.0,
+        std::numeric_limits<double>::infinity(), 1.0 / 3, 1e300};
+    for (int i = 0; i < numValues; i += 997) {
+        src[i] = exceptions[i % exceptions.size()];
+    }
+    auto alg = FloatCompression<double>();
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    ASSERT_EQ(metadata.compression, CompressionType::ALP);
+    auto header = ALPHeader::readHeader(metadata.data);
+    EXPECT_GT(header.exceptionCapacity, 0);
+
+    auto pageSize = 4096;
+    auto numValuesPerPage = metadata.numValues(pageSize, LogicalType(LogicalTypeID::DOUBLE));
+    const uint8_t* srcCursor = (uint8_t*)src.data();
+    std::vector<double> decompressed(src.size());
+    std::vector<uint8_t> page(pageSize);
+    for (auto i = 0u; i < src.size(); i += numValuesPerPage) {
+        alg.compressNextPage(srcCursor, src.size() - i, page.data(), pageSize, metadata);
+        auto numValuesInPage = std::min(numValuesPerPage, (uint64_t)src.size() - i);
+        alg.decompressFromPage(page.data(), 0, (uint8_t*)decompressed.data(), i, numValuesInPage,
+            metadata);
+        // Exceptions are written to where they belong when only part of the page is read
+        auto value = 0.0;
+        alg.decompressFromPage(page.data(), numValuesInPage - 1, (uint8_t*)&value, 0, 1, metadata);
+        EXPECT_EQ(memcmp(&value, &src[i + numValuesInPage - 1], sizeof(double)), 0);
+    }
+    // Compare the bits so that NaN and -0.0 are checked
+    EXPECT_EQ(memcmp(decompressed.data(), src.data(), src.size() * sizeof(double)), 0);
+}
+
+TEST(CompressionTests, FloatCompressionUpdateInPlace) {
+    int64_t numValues = 1000;
+    std::vector<double> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = i / 4.0;
+    }
+    src[10] = 1.0 / 3;
+    auto alg = FloatCompression<double>();
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    ASSERT_EQ(metadata.compression, CompressionType::ALP);
+    EXPECT_FALSE(metadata.canAlwaysUpdateInPlace());
+
+    std::vector<double> updates = {12.5, 1.0 / 7, 10000.25, -1, 0.125};
+    EXPECT_TRUE(metadata.canUpdateInPlace((uint8_t*)updates.data(), 0, PhysicalTypeID::DOUBLE));
+    EXPECT_FALSE(metadata.canUpdateInPlace((uint8_t*)updates.data(), 1, PhysicalTypeID::DOUBLE));
+    EXPECT_FALSE(metadata.canUpdateInPlace((uint8_t*)updates.data(), 2, PhysicalTypeID::DOUBLE));
+    EXPECT_FALSE(metadata.canUpdateInPlace((uint8_t*)updates.data(), 3, PhysicalTypeID::DOUBLE));
+    EXPECT_FALSE(metadata.canUpdateInPlace((uint8_t*)updates.data(), 4, PhysicalTypeID::DOUBLE));
+
+    auto pageSize = 4096;
+    std::vector<uint8_t> page(pageSize);
+    const uint8_t* srcCursor = (uint8_t*)src.data();
+    alg.compressNextPage(srcCursor, src.size(), page.data(), pageSize, metadata);
+    // Overwrite both a bitpacked value and an exception
+    alg.setValuesFromUncompressed((uint8_t*)updates.data(), 0, page.data(), 5, 1, metadata);
+    alg.setValuesFromUncompressed((uint8_t*)updates.data(), 1, page.data(), 10, 1, metadata);
+    src[5] = updates[0];
+    src[10] = updates[1];
+    std::vector<double> decompressed(src.size());
+    alg.decompressFromPage(page.data(), 0, (uint8_t*)decompressed.data(), 0, src.size(), metadata);
+    EXPECT_EQ(decompressed, src);
+}
+
+TEST(CompressionTests, FloatCompressionFallsBackToUncompressed) {
+    int64_t numValues = 10000;
+    std::vector<double> src(numValues);
+    uint64_t state = 1;
+    for (int i = 0; i < numValues; i++) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        src[i] = (double)(state >> 11) / (1ULL << 53);
+    }
+    auto alg = FloatCompression<double>();
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    EXPECT_EQ(metadata.compression, CompressionType::UNCOMPRESSED);
+    compressionMultiPage(alg, src, metadata, LogicalType(LogicalTypeID::DOUBLE));
+}
+
+template<typename T>
+void unpackKernelsMatchScalar(bool hasNegative, T offset) {
+    using U = std::make_unsigned_t<T>;
+    static constexpr uint64_t numChunks = 10;
+    static constexpr uint64_t numValues = numChunks * 32;
+    uint64_t state = 1;
+    auto maxBitWidth = sizeof(T) * 8 - (hasNegative ? 1 : 0);
+    for (uint8_t bitWidth = 1; bitWidth <= maxBitWidth; bitWidth++) {
+        std::vector<T> src(numValues);
+        for (auto i = 0u; i < numValues; i++) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            auto value = (U)(state >> 1);
+            if (bitWidth < sizeof(T) * 8) {
+                value &= ((U)1 << bitWidth) - 1;
+            }
+            if (hasNegative && (value >> (bitWidth - 1)) & 1) {
+                // Sign extend
+                value |= ~(U)0 << (bitWidth - 1);
+            }
+            src[i] = (T)(value + (U)offset);
+        }
+        auto header = BitpackHeader{bitWidth, hasNegative, (uint64_t)offset};
+        auto metadata = CompressionMetadata(CompressionType::INTEGER_BITPACKING, header.getData());
+        std::vector<uint8_t> packed(4096);
+        const uint8_t* srcCursor = (uint8_t*)src.data();
+        IntegerBitpacking<T>().compressNextPage(srcCursor, numValues, packed.data(),
+            packed.size(), metadata);
+        // Only pass the packed bytes, so that reading past them is detected by sanitizers
+        std::vector<uint8_t> input(packed.begin(), packed.begin() + numValues * bitWidth / 8);
+        for (auto kernel : {UnpackKernel::SCALAR, UnpackKernel::AVX2, UnpackKernel::AVX512}) {
+            if (!isUnpackKernelSupported(kernel)) {
+                continue;
+            }
+            for (auto chunks : {numChunks, (uint64_t)1}) {
+                std::vector<T> result(chunks * 32);
+                unpackChunks(input.data() + (numChunks - chunks) * 32 * bitWidth / 8,
+                    result.data(), chunks, header, kernel);
+                EXPECT_TRUE(std::equal(result.begin(), result.end(),
+                    src.begin() + (numChunks - chunks) * 32))
+                    << "bitWidth " << (int)bitWidth << ", kernel " << (int)kernel;
+            }
+        }
+    }
+}
+
+TEST(CompressionTests, UnpackKernelsMatchScalar) {
+    unpackKernelsMatchScalar<uint64_t>(false, 0);
+    unpackKernelsMatchScalar<int64_t>(true, -100000);
+    unpackKernelsMatchScalar<int64_t>(false, INT64_MIN / 2);
+    unpackKernelsMatchScalar<uint32_t>(false, 5);
+    unpackKernelsMatchScalar<int32_t>(true, 0);
+    unpackKernelsMatchScalar<int16_t>(true, 7);
+    unpackKernelsMatchScalar<uint8_t>(false, 0);
+}
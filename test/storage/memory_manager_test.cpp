@@ -0,0 +1,83 @@
+#include <cstring>
+#include <filesystem>
+
+#include "common/exception/buffer_manager.h"
+#include "common/file_system/virtual_file_system.h"
+#include "gtest/gtest.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "test_helper/test_helper.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+using namespace kuzu::testing;
+
+class MemoryManagerTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        tempDir = TestHelper::appendKuzuRootPath(
+            TestHelper::TMP_TEST_DIR + TestHelper::getMillisecondsSuffix());
+        vfs = std::make_unique<VirtualFileSystem>();
+        vfs->createDir(tempDir);
+        bm = std::make_unique<BufferManager>(NUM_FRAMES * BufferPoolConstants::PAGE_256KB_SIZE,
+            BufferPoolConstants::DEFAULT_VM_REGION_MAX_SIZE);
+    }
+
+    void TearDown() override {
+        mm.reset();
+        bm.reset();
+        std::filesystem::remove_all(tempDir);
+    }
+
+    std::string getSpillFilePath() const {
+        return vfs->joinPath(tempDir, StorageConstants::SPILL_FILE_NAME);
+    }
+
+public:
+    static constexpr uint64_t NUM_FRAMES = 16;
+    std::string tempDir;
+    std::unique_ptr<VirtualFileSystem> vfs;
+    std::unique_ptr<BufferManager> bm;
+    std::unique_ptr<MemoryManager> mm;
+};
+
+TEST_F(MemoryManagerTest, SpillUnpinnedBuffers) {
+    mm = std::make_unique<MemoryManager>(bm.get(), vfs.get(), getSpillFilePath());
+    ASSERT_TRUE(mm->canSpill());
+    auto pageSize = BufferPoolConstants::PAGE_256KB_SIZE;
+    std::vector<std::unique_ptr<MemoryBuffer>> buffers;
+    std::vector<uint8_t*> addresses;
+    for (auto i = 0u; i < 4 * NUM_FRAMES; i++) {
+        auto buffer = mm->allocateBuffer();
+        memset(buffer->buffer, i, pageSize);
+        addresses.push_back(buffer->buffer);
+        buffer->unpin();
+        buffers.push_back(std::move(buffer));
+    }
+    for (auto i = 0u; i < buffers.size(); i++) {
+        buffers[i]->pin();
+        ASSERT_EQ(buffers[i]->buffer, addresses[i]);
+        ASSERT_EQ(buffers[i]->buffer[0], (uint8_t)i);
+        ASSERT_EQ(buffers[i]->buffer[pageSize - 1], (uint8_t)i);
+        buffers[i]->unpin();
+    }
+    // Freed buffers are reused whether or not they are pinned.
+    buffers[0]->pin();
+    buffers.clear();
+    auto buffer = mm->allocateBuffer(true /* initializeToZero */);
+    ASSERT_EQ(buffer->buffer[pageSize - 1], 0);
+    buffer.reset();
+    mm.reset();
+    ASSERT_FALSE(vfs->fileOrPathExists(getSpillFilePath()));
+}
+
+TEST_F(MemoryManagerTest, InMemBuffersAreNotSpilled) {
+    mm = std::make_unique<MemoryManager>(bm.get(), vfs.get());
+    ASSERT_FALSE(mm->canSpill());
+    std::vector<std::unique_ptr<MemoryBuffer>> buffers;
+    for (auto i = 0u; i < NUM_FRAMES; i++) {
+        buffers.push_back(mm->allocateBuffer());
+        buffers.back()->unpin();
+    }
+    ASSERT_THROW(mm->allocateBuffer(), BufferManagerException);
+}
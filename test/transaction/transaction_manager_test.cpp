@@ -1,3 +1,5 @@
+#include <thread>
+
 #include "common/exception/transaction_manager.h"
 #include "graph_test/graph_test.h"
 #include "transaction/transaction_manager.h"
@@ -52,6 +54,7 @@ private:
 };
 
 TEST_F(TransactionManagerTest, MultipleWriteTransactionsErrors) {
+    transactionManager->setWaitTimeoutForWriteTransactionInMicros(10000 /* 10ms */);
     std::unique_ptr<Transaction> trx1 =
         transactionManager->beginWriteTransaction(*getClientContext(*conn));
     try {
@@ -60,6 +63,22 @@ TEST_F(TransactionManagerTest, MultipleWriteTransactionsErrors) {
     } catch (TransactionManagerException& e) {}
 }
 
+TEST_F(TransactionManagerTest, WriteTransactionsWaitForActiveWriteTransaction) {
+    std::unique_ptr<Transaction> trx1 =
+        transactionManager->beginWriteTransaction(*getClientContext(*conn));
+    std::unique_ptr<Transaction> trx2;
+    std::thread waitingThread([&]() {
+        trx2 = transactionManager->beginWriteTransaction(*getClientContext(*conn));
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ASSERT_EQ(trx1->getID(), transactionManager->getActiveWriteTransactionID());
+    transactionManager->commit(trx1.get());
+    waitingThread.join();
+    ASSERT_EQ(trx2->getID(), transactionManager->getActiveWriteTransactionID());
+    transactionManager->rollback(trx2.get());
+    ASSERT_FALSE(transactionManager->hasActiveWriteTransactionID());
+}
+
 TEST_F(TransactionManagerTest, MultipleCommitsAndRollbacks) {
     // At TransactionManager level, we disallow multiple commit/rollbacks on a write transaction.
     try {
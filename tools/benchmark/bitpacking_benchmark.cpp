@@ -0,0 +1,83 @@
+// Micro-benchmark of the kernels used to unpack bitpacked integer column pages.
+// Usage: kuzu_bitpacking_benchmark [numIterations]
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "common/constants.h"
+#include "storage/compression/bitpacking_unpack.h"
+#include "storage/compression/compression.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+static std::string getKernelName(UnpackKernel kernel) {
+    switch (kernel) {
+    case UnpackKernel::SCALAR:
+        return "scalar";
+    case UnpackKernel::AVX2:
+        return "avx2";
+    case UnpackKernel::AVX512:
+        return "avx512";
+    default:
+        return "unknown";
+    }
+}
+
+template<typename T>
+static void benchmark(const std::string& typeName, uint8_t bitWidth, bool hasNegative,
+    uint64_t numIterations) {
+    // One page worth of values
+    auto header = BitpackHeader{bitWidth, hasNegative, 1000 /*offset*/};
+    auto metadata = CompressionMetadata(CompressionType::INTEGER_BITPACKING, header.getData());
+    auto numValues = IntegerBitpacking<T>::numValues(BufferPoolConstants::PAGE_4KB_SIZE, header);
+    std::vector<T> values(numValues);
+    uint64_t state = 1;
+    for (auto& value : values) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        auto mask = bitWidth == 64 ? ~0ull : (1ull << (bitWidth - (hasNegative ? 1 : 0))) - 1;
+        value = (T)((state >> 1) & mask) + (T)header.offset;
+    }
+    std::vector<uint8_t> page(BufferPoolConstants::PAGE_4KB_SIZE);
+    auto srcCursor = reinterpret_cast<const uint8_t*>(values.data());
+    IntegerBitpacking<T>().compressNextPage(srcCursor, numValues, page.data(), page.size(),
+        metadata);
+    std::vector<T> result(numValues);
+    auto numChunks = numValues / 32;
+    for (auto kernel : {UnpackKernel::SCALAR, UnpackKernel::AVX2, UnpackKernel::AVX512}) {
+        if (!isUnpackKernelSupported(kernel)) {
+            continue;
+        }
+        // Keeps the unpacking from being optimized away
+        T checksum = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (auto i = 0u; i < numIterations; i++) {
+            unpackChunks(page.data(), result.data(), numChunks, header, kernel);
+            checksum += result[i % numValues];
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto ns = std::chrono::duration<double, std::nano>(end - start).count();
+        std::cout << typeName << "\t" << (int)bitWidth << "\t" << (hasNegative ? "yes" : "no")
+                  << "\t" << getKernelName(kernel) << "\t"
+                  << ns / (double)(numIterations * numValues) << "\t" << (int64_t)checksum
+                  << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    uint64_t numIterations = argc > 1 ? std::stoull(argv[1]) : 20000;
+    std::cout << "best kernel: " << getKernelName(getBestUnpackKernel()) << std::endl;
+    std::cout << "type\tbits\tnegative\tkernel\tns/value\tchecksum" << std::endl;
+    for (auto bitWidth : {3, 8, 13, 21, 32, 47, 56, 60}) {
+        benchmark<int64_t>("INT64", bitWidth, false /*hasNegative*/, numIterations);
+    }
+    benchmark<int64_t>("INT64", 21, true /*hasNegative*/, numIterations);
+    for (auto bitWidth : {3, 8, 13, 21, 25, 30}) {
+        benchmark<int32_t>("INT32", bitWidth, false /*hasNegative*/, numIterations);
+    }
+    benchmark<int16_t>("INT16", 11, false /*hasNegative*/, numIterations);
+    return 0;
+}